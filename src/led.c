@@ -7,8 +7,8 @@
 * @brief    LED manipulations
 * @author   Ziga Miklosic
 * @email    ziga.miklosic@gmail.com
-* @date     08.11.2023
-* @version  V1.1.0
+* @date     14.10.2026
+* @version  V1.2.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "led.h"
 
@@ -34,7 +35,13 @@
  *     LED handler period in second and frequency in Hz
  */
 #define LED_HNDL_PERIOD_S                   ( LED_CFG_HNDL_PERIOD_S )
-#define LED_HNDL_FREQ_HZ                    ((float32_t) ( 1.0 / PWR_HNDL_PERIOD_S ))
+#define LED_HNDL_FREQ_HZ                    ((float32_t) ( 1.0 / LED_HNDL_PERIOD_S ))
+
+/**
+ *     Slow LED handler period in second and frequency in Hz
+ */
+#define LED_HNDL_SLOW_PERIOD_S              ( LED_CFG_HNDL_SLOW_PERIOD_S )
+#define LED_HNDL_SLOW_FREQ_HZ               ((float32_t) ( 1.0 / LED_HNDL_SLOW_PERIOD_S ))
 
 /**
  *     Default fade IN/OUT time
@@ -43,712 +50,7179 @@
  *
  *     Unit: sec
  */
-#define LED_FADE_IN_TIME_S                  ( 1.0 )
-#define LED_FADE_OUT_TIME_S                 ( 1.0 )
+#define LED_FADE_IN_TIME_S                  ( 1.0f )
+#define LED_FADE_OUT_TIME_S                 ( 1.0f )
+
+/**
+ *     Time keeping limitations
+ */
+#define LED_TIME_LIMIT_S                    ( 1E6f )
+#define LED_TIME_LIMIT                      ( LED_TIME_FROM_S( LED_TIME_LIMIT_S ))
+#define LED_TIME_LIM(time)                  (( time > LED_TIME_LIMIT ) ? ( LED_TIME_LIMIT ) : ( time ))
+
+#if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+    /**
+     *     Timestamp conversions
+     */
+    #define LED_TS_FROM_S(time)             ((uint32_t) (( time ) * (float32_t) LED_CFG_TIMESTAMP_FREQ_HZ + 0.5f ))
+
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        #define LED_HNDL_FREQ_INT           ((uint32_t) ( LED_HNDL_FREQ_HZ + 0.5f ))
+        #define LED_TIME_FROM_TS(ts)        ((led_time_t) ((( uint64_t ) ( ts ) * LED_HNDL_FREQ_INT ) / LED_CFG_TIMESTAMP_FREQ_HZ ))
+    #else
+        #define LED_TIME_FROM_TS(ts)        ((led_time_t) ((float32_t) ( ts ) * ( 1.0f / (float32_t) LED_CFG_TIMESTAMP_FREQ_HZ )))
+    #endif
+
+#endif
+
+#if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+    /**
+     *     Time and duty conversions
+     */
+    #define LED_TIME_TICK                   ((led_time_t) ( 1U ))
+    #define LED_TIME_EPS                    ((led_time_t) ( 0U ))
+    #define LED_TIME_FROM_S(time)           ((led_time_t) (( time ) * LED_HNDL_FREQ_HZ + 0.5f ))
+    #define LED_TIME_TO_S(time)             ((float32_t) ( time ) * LED_HNDL_PERIOD_S )
+    #define LED_DUTY_MAX                    ((led_duty_t) ( 0xFFFFU ))
+    #define LED_DUTY_FROM_F(duty)           ((( duty ) >= 1.0f ) ? ( LED_DUTY_MAX ) : ((led_duty_t) (( duty ) * (float32_t) LED_DUTY_MAX + 0.5f )))
+    #define LED_DUTY_TO_F(duty)             ((float32_t) ( duty ) * ( 1.0f / (float32_t) LED_DUTY_MAX ))
+    #define LED_DUTY_TO_U8(duty)            ((uint8_t) ((( uint32_t ) ( duty ) * 255U + 0x7FFFU ) / 0xFFFFU ))
+    #define LED_DUTY_SCALE(duty,max)        ((led_duty_t) ((( uint32_t ) ( duty ) * ( max ) + 0x7FFFU ) / 0xFFFFU ))
+    #define LED_DUTY_FROM_U8(duty)          ((led_duty_t) (( duty ) * 0x0101U ))
+
+    /**
+     *     Fading factor fractional bits
+     *
+     *  @note   Fading factor is in duty LSB per tick^2 with
+     *          LED_FADE_K_FRAC fractional bits.
+     */
+    #define LED_FADE_K_FRAC                 ( 12U )
+
+    /**
+     *     Fade out end of fading limit
+     */
+    #define LED_FADE_OUT_DUTY_LIM           ((led_duty_t) ( 0U ))
+
+#else
+
+    /**
+     *     Time and duty conversions
+     */
+    #define LED_TIME_TICK                   ((led_time_t) ( LED_HNDL_PERIOD_S ))
+    #define LED_TIME_EPS                    ((led_time_t) ( LED_HNDL_PERIOD_S * 1E-3f ))
+    #define LED_TIME_FROM_S(time)           ((led_time_t) ( time ))
+    #define LED_TIME_TO_S(time)             ((float32_t) ( time ))
+    #define LED_DUTY_MAX                    ((led_duty_t) ( 1.0f ))
+    #define LED_DUTY_FROM_F(duty)           ((led_duty_t) ( duty ))
+    #define LED_DUTY_TO_F(duty)             ((float32_t) ( duty ))
+    #define LED_DUTY_TO_U8(duty)            ((( duty ) >= 1.0f ) ? ( 255U ) : ((uint8_t) (( duty ) * 255.0f + 0.5f )))
+    #define LED_DUTY_SCALE(duty,max)        ((led_duty_t) (( duty ) * ( max )))
+    #define LED_DUTY_FROM_U8(duty)          ((led_duty_t) ((float32_t) ( duty ) * ( 1.0f / 255.0f )))
+
+    /**
+     *     Fade out end of fading limit
+     */
+    #define LED_FADE_OUT_DUTY_LIM           ((led_duty_t) ( 0.001f ))
+
+#endif
+
+#if ( 1 == LED_CFG_FADE_LUT_EN )
+
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+        /**
+         *     Fading curve end and position conversions
+         */
+        #define LED_FADE_POS_END            ((led_fade_pos_t) (( LED_CFG_FADE_LUT_SIZE - 1UL ) << 16U ))
+        #define LED_FADE_POS_TO_IDX(pos)    ((uint32_t) (( pos ) >> 16U ))
+        #define LED_FADE_POS_FROM_IDX(idx)  ((led_fade_pos_t) (( idx ) << 16U ))
+
+        /**
+         *     Maximum elapsed time for fading curve step
+         *
+         *  @note   Limitation prevents overflow of fading position step.
+         *
+         *     Unit: tick
+         */
+        #define LED_FADE_DT_LIM             ((led_time_t) ( 255U ))
+
+    #else
+
+        /**
+         *     Fading curve end and position conversions
+         */
+        #define LED_FADE_POS_END            ((led_fade_pos_t) ( LED_CFG_FADE_LUT_SIZE - 1 ))
+        #define LED_FADE_POS_TO_IDX(pos)    ((uint32_t) ( pos ))
+        #define LED_FADE_POS_FROM_IDX(idx)  ((led_fade_pos_t) ( idx ))
+
+    #endif
+
+#endif
+
+#if ( 1 == LED_FADE_PROFILE_EN )
+
+    /**
+     *     Default fading profile
+     */
+    #define LED_FADE_PROFILE_DEF            ( 0U )
+
+#endif
+
+#if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+    /**
+     *     No timer DMA waveform buffer
+     */
+    #define LED_DMA_BUF_NONE                ((uint8_t) ( 0xFFU ))
+
+    /**
+     *     Timer DMA waveform sample time
+     *
+     * @note    In units of LED time (ticks or seconds).
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        #define LED_DMA_SAMPLE_TIME         ( LED_HNDL_FREQ_HZ / (float32_t) LED_CFG_TIMER_DMA_FREQ_HZ )
+    #else
+        #define LED_DMA_SAMPLE_TIME         ( 1.0f / (float32_t) LED_CFG_TIMER_DMA_FREQ_HZ )
+    #endif
+
+    /**
+     *     Timer driven by DMA waveform
+     */
+    #define LED_DMA_IS_ACTIVE(num)          ( LED_DMA_BUF_NONE != p_ctx->p_led[num].dma_buf )
+
+    /**
+     *     Timer DMA waveform
+     */
+    typedef enum
+    {
+        eLED_DMA_WAVE_NONE = 0,     /**<No waveform */
+        eLED_DMA_WAVE_FADE_IN,      /**<Fade in waveform */
+        eLED_DMA_WAVE_FADE_OUT,     /**<Fade out waveform */
+    } led_dma_wave_t;
+
+#else
+    #define LED_DMA_IS_ACTIVE(num)          ( false )
+#endif
+
+/**
+ *     Number of LED groups
+ *
+ * @note    Each group has its own state machine placed after LEDs
+ *          inside LED data.
+ */
+#if ( 1 == LED_CFG_GROUP_EN )
+    #define LED_GROUP_NUM_OF                ( eLED_GROUP_NUM_OF )
+#else
+    #define LED_GROUP_NUM_OF                ( 0 )
+#endif
 
 /**
- *      Default fading factor
+ *     Default instance
  *
- *      @note Times two is becase of x^2 derivative is 2x
+ * @note    Buffered low level drivers, timer DMA waveforms, groups and
+ *          command queue are available to default instance only.
+ */
+#define LED_CTX_IS_DEF(p_ctx)               ( &g_led_ctx == ( p_ctx ))
+
+/**
+ *     Number of LED data rows of instance
  *
- *      Unit: duty [0-1.0]
+ * @note    Group state machines are placed after LEDs of default
+ *          instance only.
  */
-#define LED_FADE_IN_COEF_T_TO_DUTY          (float32_t) ( 2.0 * 1.0 / ( LED_FADE_IN_TIME_S * LED_FADE_IN_TIME_S ))
-#define LED_FADE_OUT_COEF_T_TO_DUTY         (float32_t) ( 2.0 * 1.0 / ( LED_FADE_OUT_TIME_S * LED_FADE_OUT_TIME_S ))
+#define LED_CTX_ROW_NUM_OF(p_ctx)           ((uint16_t) (( p_ctx )->num_of + ( LED_CTX_IS_DEF( p_ctx ) ? LED_GROUP_NUM_OF : 0U )))
 
 /**
- *     Time keeping limitations
+ *     Instance initialized
  */
-#define LED_TIME_LIMIT_S                    ( 1E6f )
-#define LED_TIME_LIM(time)                  (( time > LED_TIME_LIMIT_S ) ? ( LED_TIME_LIMIT_S ) : ( time ))
+#define LED_CTX_IS_INIT(p_ctx)              (( NULL != ( p_ctx )) && ( true == ( p_ctx )->is_init ))
 
 /**
- *     Blink counter continuous code
+ *     Low level driver available to additional instances
  */
-#define LED_BLINK_CNT_CONT_VAL              ((uint8_t) ( 0xFFU ))
+#define LED_CTX_DRV_IS_OK(drv)              (( eLED_DRV_GPIO == ( drv )) || ( eLED_DRV_TIMER_PWM == ( drv )))
 
 /**
- *     LED mode
+ *     Options available to default instance only
+ *
+ * @note    Additional instances fail to initialize when any of them is
+ *          enabled.
  */
-typedef enum
-{
-    eLED_MODE_NORMAL = 0,       /**<Normal mode */
-    eLED_MODE_FADE_IN,          /**<Fade-in mode */
-    eLED_MODE_FADE_OUT,         /**<Fade-out mode */
-    eLED_MODE_FADE_TOGGLE,      /**<Fade-in-out continuously */
-    eLED_MODE_BLINK,            /**<Blink mode */
-    eLED_MODE_FADE_BLINK,       /**<Blink mode with fading */
+#if (( 1 == LED_CFG_GROUP_EN ) || ( 1 == LED_CFG_CMD_QUEUE_EN ) || ( 1 == LED_CFG_TIMER_DMA_EN ) || ( 1 == LED_CFG_TRACE_EN ) || ( 1 == LED_CFG_PHASE_EN ))
+    #define LED_CTX_DEF_ONLY_EN             ( 1 )
+#else
+    #define LED_CTX_DEF_ONLY_EN             ( 0 )
+#endif
 
-    eLED_MODE_NUM_OF
-} led_mode_t;
+/**
+ *     Group state machine number
+ */
+#define LED_GROUP_TO_NUM(group)             ((led_num_t) ( eLED_NUM_OF + ( group )))
 
 /**
- *     LED data
+ *     Maximum number of sequence steps executed per handler call
+ *
+ * @note    Protects against jump loops without step time.
  */
-typedef struct
-{
-    float32_t   duty;           /**<Duty cycle of LED */
-    float32_t   max_duty;       /**<Maximum duty cycle of LED */
-    float32_t   fade_time;      /**<Time for fading functionalities */
-    float32_t   fade_in_k;      /**<Fade in factor */
-    float32_t   fade_out_k;     /**<Fade out factor */
-    float32_t   fade_out_time;  /**<Time for fading out */
-    float32_t   period;         /**<Period of toggle mode */
-    float32_t   per_time;       /**<Period time keeping */
-    float32_t   on_time;        /**<On time for blink mode */
-    float32_t   active_time;    /**<LED active time - turned ON time */
-    led_mode_t  mode;           /**<Current LED mode */
-    uint8_t     blink_cnt;      /**<Blink LED live counter */
-} led_t;
+#define LED_SEQ_STEP_LIMIT                  ( 16U )
 
-////////////////////////////////////////////////////////////////////////////////
-// Variables
-////////////////////////////////////////////////////////////////////////////////
+/**
+ *     Number of enabled low level drivers
+ */
+#define LED_DRV_NUM_OF_EN                   (   LED_CFG_GPIO_USE_EN + LED_CFG_TIMER_USE_EN + LED_CFG_GPIO_PORT_USE_EN \
+                                            +   LED_CFG_FRAME_USE_EN + LED_CFG_PIXEL_USE_EN + LED_CFG_BCM_USE_EN \
+                                            +   LED_CFG_ASYNC_USE_EN )
 
 /**
- *     LED data
+ *     Low level driver enabled
  */
-static led_t g_led[ eLED_NUM_OF ] = { 0 };
+#define LED_DRV_IS_EN(drv)                  (   (( eLED_DRV_GPIO == ( drv )) && ( 1 == LED_CFG_GPIO_USE_EN )) \
+                                            ||  (( eLED_DRV_TIMER_PWM == ( drv )) && ( 1 == LED_CFG_TIMER_USE_EN )) \
+                                            ||  (( eLED_DRV_GPIO_PORT == ( drv )) && ( 1 == LED_CFG_GPIO_PORT_USE_EN )) \
+                                            ||  (( eLED_DRV_FRAME == ( drv )) && ( 1 == LED_CFG_FRAME_USE_EN )) \
+                                            ||  (( eLED_DRV_PIXEL == ( drv )) && ( 1 == LED_CFG_PIXEL_USE_EN )) \
+                                            ||  (( eLED_DRV_BCM == ( drv )) && ( 1 == LED_CFG_BCM_USE_EN )) \
+                                            ||  (( eLED_DRV_ASYNC == ( drv )) && ( 1 == LED_CFG_ASYNC_USE_EN )))
 
 /**
- *     Initialization guard
+ *     Low level driver with duty cycle resolution
  */
-static bool gb_is_init = false;
+#define LED_DRV_IS_DIM(drv)                 (   ( eLED_DRV_TIMER_PWM == ( drv )) \
+                                            ||  ( eLED_DRV_PIXEL == ( drv )) \
+                                            ||  ( eLED_DRV_BCM == ( drv )) \
+                                            ||  ( eLED_DRV_ASYNC == ( drv )))
 
 /**
- *     Pointer to configuration table
+ *     Fold polarity into output value
+ *
+ * @note    Output "val" in range [0, full] is mirrored when "pol" is 1,
+ *          without branching on polarity.
  */
-static const led_cfg_t * gp_cfg_table = NULL;
+#define LED_POL_FOLD(val,full,pol)          (( (int32_t) ( full ) * (int32_t) ( pol )) + (( 1 - ( 2 * (int32_t) ( pol ))) * (int32_t) ( val )))
 
-////////////////////////////////////////////////////////////////////////////////
-// Function Prototypes
-////////////////////////////////////////////////////////////////////////////////
-static void         led_fade_in_hndl        (const led_num_t num, const led_mode_t exit_mode);
-static void         led_fade_out_hndl       (const led_num_t num, const led_mode_t exit_mode);
-static void         led_blink_hndl          (const led_num_t num);
-static void         led_fade_blink_hndl     (const led_num_t num);
-static void         led_hndl_period_time    (const led_num_t num);
-static bool         led_is_on_time          (const led_num_t num);
-static bool         led_is_period_time      (const led_num_t num);
-static void         led_blink_cnt_hndl      (const led_num_t num);
-static void         led_manage_time         (const led_num_t num);
-static led_status_t led_check_drv_init      (void);
-static void         led_set_gpio            (const led_num_t led_num, const float32_t duty, const float32_t duty_max);
-static void         led_set_timer           (const led_num_t led_num, const float32_t duty);
-static void         led_set_low             (const led_num_t led_num, const float32_t duty, const float32_t duty_max);
+#if ( 1 == LED_CFG_LIMIT_EN )
 
-////////////////////////////////////////////////////////////////////////////////
-// Functions
-////////////////////////////////////////////////////////////////////////////////
+    /**
+     *     Current budget
+     *
+     * @note    Estimated current is kept in units of mA/255, as
+     *          duty cycle is taken in 8-bit resolution.
+     */
+    #define LED_LIMIT_BUDGET                ((uint32_t) ( LED_CFG_LIMIT_BUDGET_MA ) * 255UL )
+
+    /**
+     *     Apply global brightness and current limit
+     */
+    #define LED_LIMIT_APPLY(duty)           ( LED_DUTY_SCALE( duty, p_ctx->limit_scale ))
+
+#else
+    #define LED_LIMIT_APPLY(duty)           ( duty )
+#endif
 
-////////////////////////////////////////////////////////////////////////////////
 /**
-*       Manage LED timings
-*
-* @param[in]    num     - Number of LED
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_manage_time(const led_num_t num)
-{
-    if ( g_led[num].duty >= ( g_led[num].max_duty / 2.0f ))
-    {
-        g_led[num].active_time += LED_HNDL_PERIOD_S;
-        g_led[num].active_time = LED_TIME_LIM( g_led[num].active_time );
-    }
-    else
-    {
-        g_led[num].active_time = 0.0f;
-    }
-}
+ *     Statistics counter increment
+ */
+#if ( 1 == LED_CFG_STATS_EN )
+    #define LED_STATS_INC(cnt)              { p_ctx->stats.cnt++; }
+#else
+    #define LED_STATS_INC(cnt)              { (void) p_ctx; }
+#endif
 
-////////////////////////////////////////////////////////////////////////////////
 /**
-*       Fade in FMS state
-*
-* @param[in]    num         - LED number
-* @param[in]    exit_mode   - Mode to transition on exit
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_fade_in_hndl(const led_num_t num, const led_mode_t exit_mode)
-{
-    // Increase duty by the square function
-    g_led[num].duty += ( g_led[num].fade_in_k * g_led[num].fade_time * (float32_t) LED_HNDL_PERIOD_S );
+ *     Blink counter continuous code
+ */
+#define LED_BLINK_CNT_CONT_VAL              ((uint8_t) ( eLED_BLINK_CONTINUOUS ))
 
-    // Is LED fully ON?
-    if ( g_led[num].duty <= g_led[num].max_duty )
-    {
-        // Increment time
-        g_led[num].fade_time += LED_HNDL_PERIOD_S;
-        g_led[num].fade_time = LED_TIME_LIM( g_led[num].fade_time );
-    }
+#if ( 0 == LED_CFG_TIMESTAMP_EN )
 
-    // LED fully ON
-    else
+    /**
+     *     Elapsed time skipped on first handler call after blink start
+     */
+    typedef enum
     {
-        // Limit duty
-        g_led[num].duty = g_led[num].max_duty;
+        eLED_PER_SKIP_NONE = 0,     /**<Elapsed time is part of blink period */
+        eLED_PER_SKIP_ALL,          /**<Elapsed time is before blink start */
+        eLED_PER_SKIP_TICK,         /**<Elapsed time above one handler period is after blink start */
+    } led_per_skip_t;
 
-        // Reset time
-        g_led[num].fade_time = 0.0f;
-
-        // Goto NORMAL mode
-        g_led[num].mode = exit_mode;
-    }
-}
+#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Fade out FMS state
-*
-* @param[in]    num            - LED number
-* @param[in]    exit_mode    - Mode to transition on exit
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_fade_out_hndl(const led_num_t num, const led_mode_t exit_mode)
-{
-    float32_t time = 0.0f;
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
 
-    // Calculate negative time in order to get square characteristics in negative time domain
-    time = ( g_led[num].fade_out_time - g_led[num].fade_time );
+    /**
+     *     Command queue index mask
+     */
+    #define LED_CMD_QUEUE_MASK              ((uint32_t) ( LED_CFG_CMD_QUEUE_SIZE - 1U ))
 
-    // Watch out for end of negative characteristics
-    if ( time > 0.0f  )
-    {
-        g_led[num].duty -= g_led[num].fade_out_k * ( time * (float32_t) LED_HNDL_PERIOD_S );
-    }
-    else
+    /**
+     *     LED command type
+     */
+    typedef enum
     {
-        g_led[num].duty = 0.0f;
-    }
+        eLED_CMD_SET = 0,           /**<Set LED state */
+        eLED_CMD_TOGGLE,            /**<Toggle LED */
+        eLED_CMD_BLINK,             /**<Blink LED */
+        eLED_CMD_SET_SMOOTH,        /**<Fade LED */
+        eLED_CMD_BLINK_SMOOTH,      /**<Smooth blink LED */
+    } led_cmd_type_t;
 
-    // Is LED fully OFF?
-    if ( g_led[num].duty > 0.001f )
+    /**
+     *     LED command
+     */
+    typedef struct
     {
-        // Increment time
-        g_led[num].fade_time += LED_HNDL_PERIOD_S;
-        g_led[num].fade_time = LED_TIME_LIM( g_led[num].fade_time );
-    }
+        float32_t       on_time;    /**<Blink ON time */
+        float32_t       period;     /**<Blink period */
+        uint16_t        num;        /**<LED number */
+        uint8_t         type;       /**<Command type, "led_cmd_type_t" */
+        uint8_t         arg;        /**<LED state or number of blinks */
+    } led_cmd_t;
 
-    // LED fully OFF
-    else
+    /**
+     *     Command queue slot
+     *
+     * @note    Slot sequence tells whether slot is free for producer or
+     *          ready for consumer.
+     */
+    typedef struct
     {
-        // Limit duty
-        g_led[num].duty = 0.0f;
+        volatile uint32_t   seq;    /**<Slot sequence */
+        led_cmd_t           cmd;    /**<Command */
+    } led_cmd_slot_t;
 
-        // Reset time
-        g_led[num].fade_time = 0.0f;
+#endif
 
-        // Goto NORMAL mode
-        g_led[num].mode = exit_mode;
-    }
-}
+#if ( 1 == LED_CFG_TRACE_EN )
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       LED blink FSM state
-*
-* @param[in]    num            - LED number
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_blink_hndl(const led_num_t num)
-{
-    if ( true == led_is_on_time( num ))
-    {
-        g_led[num].duty = g_led[num].max_duty;
-    }
-    else
-    {
-        g_led[num].duty = 0.0f;
-    }
+    /**
+     *     Trace ring position mask
+     */
+    #define LED_TRACE_MASK                  ((uint32_t) ( LED_CFG_TRACE_SIZE - 1U ))
 
-    // Manage blink counter
-    led_blink_cnt_hndl( num );
-}
+    /**
+     *     Maximum size of trace entry
+     *
+     * @note    Tick delta varint (5) + LED number varint (3) + duty (2)
+     */
+    #define LED_TRACE_ENTRY_SIZE            ( 10U )
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       LED fade blink FSM state
-*
-* @param[in]    num            - LED number
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_fade_blink_hndl(const led_num_t num)
-{
-    if ( true == led_is_on_time( num ))
-    {
-        led_fade_in_hndl( num , eLED_MODE_FADE_BLINK);
-    }
-    else
-    {
-        led_fade_out_hndl( num, eLED_MODE_FADE_BLINK );
-    }
+    /**
+     *     LED number of lost entries marker
+     *
+     * @note    Marker entry carries number of lost entries instead of duty.
+     */
+    #define LED_TRACE_NUM_LOST              ( 0xFFFFU )
 
-    // Manage blink counter
-    led_blink_cnt_hndl( num );
-}
+    /**
+     *     Duty of trace entry in Q16 format
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        #define LED_TRACE_DUTY(duty)        ((uint16_t) ( duty ))
+    #else
+        #define LED_TRACE_DUTY(duty)        ((( duty ) >= 1.0f ) ? ( 0xFFFFU ) : ((uint16_t) (( duty ) * 65535.0f + 0.5f )))
+    #endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Period time handler
-*
-* @param[in]    num            - LED number
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_hndl_period_time(const led_num_t num)
-{
-    if ( g_led[num].per_time >= g_led[num].period )
-    {
-        g_led[num].per_time = 0.0f;
-    }
-    else
-    {
-        g_led[num].per_time += LED_HNDL_PERIOD_S;
-    }
-}
+    /**
+     *     Duty of driver value in range [0, full]
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        #define LED_TRACE_OUT_DUTY(val,full)    ((led_duty_t) ((( uint32_t ) ( val ) * 0xFFFFU + (( full ) / 2U )) / ( full )))
+    #else
+        #define LED_TRACE_OUT_DUTY(val,full)    ((led_duty_t) ((float32_t) ( val ) / (float32_t) ( full )))
+    #endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Check if it is time for ON LED state
-*
-* @param[in]    num            - LED number
-* @return       is_on_time    - Is currently LED on or off
-*/
-////////////////////////////////////////////////////////////////////////////////
-static bool led_is_on_time(const led_num_t num)
-{
-    bool is_on_time = false;
+#endif
 
-    if ( g_led[num].per_time < g_led[num].on_time )
-    {
-        is_on_time = true;
-    }
+#if ( 1 == LED_CFG_PHASE_EN )
 
-    return is_on_time;
-}
+    /**
+     *     All phase slots active
+     */
+    #define LED_PHASE_SLOT_ALL              ( 0xFFU )
+
+    /**
+     *     Number of words of deferred write bitmap
+     */
+    #define LED_PHASE_PENDING_NUM_OF        (( (uint32_t) eLED_NUM_OF + 31U ) / 32U )
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
-/**
-*       Check if it is period of blink
-*
-*   Return true only on period update
-*
-* @param[in]    num            - LED number
-* @return       is_period    - Period update event
-*/
+// Variables
 ////////////////////////////////////////////////////////////////////////////////
-static bool led_is_period_time(const led_num_t num)
-{
-    bool is_period = false;
-
-    if ( g_led[num].per_time >= g_led[num].period )
-    {
-        is_period = true;
-    }
 
-    return is_period;
-}
+/**
+ *     Default instance LED data
+ *
+ * @note    LEDs are followed by group state machines.
+ */
+static led_t g_led[ eLED_NUM_OF + LED_GROUP_NUM_OF ] = { 0 };
 
-////////////////////////////////////////////////////////////////////////////////
 /**
-*       Manage blink counter
-*
-* @param[in]    num        - LED number
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void led_blink_cnt_hndl(const led_num_t num)
-{
-    // On blink period
-    if ( true == led_is_period_time( num ))
-    {
-        // Not continuous blinking
-        if ( LED_BLINK_CNT_CONT_VAL != g_led[num].blink_cnt )
-        {
-            // Blink count expire
-            if ( 0 == g_led[num].blink_cnt )
-            {
-                g_led[num].mode = eLED_MODE_NORMAL;
-            }
+ *     Default instance
+ */
+static led_ctx_t g_led_ctx = { 0 };
 
-            // Decrease blink counts
-            else
-            {
-                g_led[num].blink_cnt--;
-            }
-        }
-    }
-}
+#if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+    /**
+     *     Timer DMA waveform buffers
+     *
+     * @note    Holds timer compare values streamed by DMA.
+     */
+    static LED_CFG_TIMER_DMA_TYPE g_dma_wave[ LED_CFG_TIMER_DMA_NUM_OF ][ LED_CFG_TIMER_DMA_SIZE ] = { 0 };
+
+    /**
+     *     Used timer DMA waveform buffers mask
+     */
+    static uint32_t g_dma_used = 0U;
+
+#endif
+
+#if ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+
+    /**
+     *     GPIO port pending set/reset masks
+     */
+    static uint32_t g_gpio_port_set[ LED_CFG_GPIO_PORT_NUM_OF ]     = { 0 };
+    static uint32_t g_gpio_port_reset[ LED_CFG_GPIO_PORT_NUM_OF ]   = { 0 };
+
+#endif
+
+#if ( 1 == LED_CFG_FRAME_USE_EN )
+
+    /**
+     *     LED frame double buffer
+     *
+     * @note    One buffer is being sent while LEDs are updated into other.
+     */
+    static uint8_t g_frame[2][ LED_CFG_FRAME_SIZE ] = { 0 };
+
+    /**
+     *     Frame buffer being updated by handler
+     */
+    static uint8_t g_frame_wr = 0;
+
+    /**
+     *     Frame change flag
+     */
+    static bool gb_frame_is_changed = false;
+
+    /**
+     *     Frame transfer in progress flag
+     */
+    static volatile bool gb_frame_tx_busy = false;
+
+#endif
+
+#if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+    /**
+     *     Pixel stream size
+     *
+     *  Unit: symbol
+     */
+    #define LED_PIXEL_STREAM_SIZE           (( LED_CFG_PIXEL_NUM_OF * LED_CFG_PIXEL_CH_NUM_OF * 8U ) + LED_CFG_PIXEL_RESET_NUM_OF )
+
+    /**
+     *     Pixel change bitmap size
+     */
+    #define LED_PIXEL_DIRTY_NUM_OF          (( LED_CFG_PIXEL_NUM_OF + 31U ) / 32U )
+
+    /**
+     *     Pixel colour buffer
+     */
+    static uint8_t g_pixel[ LED_CFG_PIXEL_NUM_OF ][ LED_CFG_PIXEL_CH_NUM_OF ] = { 0 };
+
+    /**
+     *     Encoded pixel DMA stream
+     *
+     * @note    Latch symbols at the end are kept at zero.
+     */
+    static LED_CFG_PIXEL_SYM_TYPE g_pixel_stream[ LED_PIXEL_STREAM_SIZE ] = { 0 };
+
+    /**
+     *     Changed pixels bitmap
+     */
+    static uint32_t g_pixel_dirty[ LED_PIXEL_DIRTY_NUM_OF ] = { 0 };
+
+    /**
+     *     Pixel stream transfer in progress flag
+     */
+    static volatile bool gb_pixel_tx_busy = false;
+
+#endif
+
+#if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+    /**
+     *     Asynchronous driver channel value from duty cycle
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        #define LED_ASYNC_VALUE(duty)       ((uint16_t) ((( uint32_t ) ( duty ) * LED_CFG_ASYNC_RES + 0x7FFFU ) / 0xFFFFU ))
+    #else
+        #define LED_ASYNC_VALUE(duty)       ((uint16_t) (( duty ) * (float32_t) LED_CFG_ASYNC_RES + 0.5f ))
+    #endif
+
+    /**
+     *     Asynchronous driver channel change bitmap size
+     */
+    #define LED_ASYNC_DIRTY_NUM_OF          (( LED_CFG_ASYNC_CH_NUM_OF + 31U ) / 32U )
+
+    /**
+     *     Asynchronous driver channel values
+     */
+    static uint16_t g_async_val[ LED_CFG_ASYNC_CH_NUM_OF ] = { 0 };
+
+    /**
+     *     Changed asynchronous driver channels bitmap
+     */
+    static uint32_t g_async_dirty[ LED_ASYNC_DIRTY_NUM_OF ] = { 0 };
+
+    /**
+     *     Batch of changed channels in flight
+     *
+     * @note    Written only when no batch is in flight.
+     */
+    static led_async_item_t g_async_batch[ LED_CFG_ASYNC_CH_NUM_OF ] = { 0 };
+
+    /**
+     *     Asynchronous driver batch in flight flag
+     */
+    static volatile bool gb_async_busy = false;
+
+#endif
+
+#if ( 1 == LED_CFG_BCM_USE_EN )
+
+    /**
+     *     BCM maximum level
+     */
+    #define LED_BCM_LEVEL_MAX               ((uint32_t) (( 1UL << LED_CFG_BCM_BIT_NUM_OF ) - 1UL ))
+
+    /**
+     *     Duty cycle to BCM level
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        #define LED_BCM_LEVEL(duty)         ((uint32_t) ((( uint32_t ) ( duty ) * LED_BCM_LEVEL_MAX + 0x7FFFU ) / 0xFFFFU ))
+    #else
+        #define LED_BCM_LEVEL(duty)         ((uint32_t) (( duty ) * (float32_t) LED_BCM_LEVEL_MAX + 0.5f ))
+    #endif
+
+    /**
+     *     BCM bit-plane schedule
+     *
+     * @note    Pins to set for each bit-plane and port. Other BCM pins of
+     *          port are reset. Interrupt outputs one schedule while other
+     *          is rebuilt by handler.
+     */
+    static volatile uint32_t g_bcm_plane[2][ LED_CFG_BCM_BIT_NUM_OF ][ LED_CFG_BCM_PORT_NUM_OF ] = { 0 };
+
+    /**
+     *     All BCM pins of port
+     */
+    static uint32_t g_bcm_port_mask[ LED_CFG_BCM_PORT_NUM_OF ] = { 0 };
+
+    /**
+     *     Schedule used by interrupt
+     */
+    static volatile uint8_t g_bcm_rd = 0U;
+
+    /**
+     *     New schedule ready flag
+     *
+     * @note    Schedules are swapped at start of BCM cycle.
+     */
+    static volatile bool gb_bcm_is_ready = false;
+
+    /**
+     *     Bit-plane being output by interrupt
+     */
+    static volatile uint8_t g_bcm_bit = 0U;
+
+    /**
+     *     BCM level change flag
+     */
+    static bool gb_bcm_is_changed = false;
+
+#endif
+
+#if ( 1 == LED_CFG_GAMMA_EN )
+
+    /**
+     *     Perceptual brightness correction table
+     */
+    static led_duty_t g_gamma_lut[ LED_CFG_GAMMA_LUT_SIZE ] = { 0 };
+
+    /**
+     *     Perceptual brightness correction table built
+     *
+     * @note    Table is shared by all instances.
+     */
+    static bool gb_gamma_is_built = false;
+
+#endif
+
+#if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+    /**
+     *     Active list clock rebase time
+     *
+     * @note    Clock is periodically moved back to zero in order to keep
+     *          time resolution of idle LEDs active time.
+     *
+     *  Unit: sec
+     */
+    #define LED_CLOCK_REBASE_S              ( 60.0f )
+
+    /**
+     *     Count trailing zeros
+     *
+     * @note    Value must not be zero!
+     */
+    #if defined( __GNUC__ )
+        #define LED_CTZ(x)                  ((uint32_t) __builtin_ctz( x ))
+    #else
+        #define LED_CTZ(x)                  ( led_ctz( x ))
+    #endif
+
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+
+    /**
+     *     Command queue
+     */
+    static led_cmd_slot_t g_cmd_queue[ LED_CFG_CMD_QUEUE_SIZE ] = { 0 };
+
+    /**
+     *     Command queue write (producers) and read (handler) position
+     */
+    static volatile uint32_t g_cmd_wr = 0U;
+    static uint32_t g_cmd_rd = 0U;
+
+    /**
+     *     Position of latest set command per LED
+     *
+     * @note    Older commands of same LED are skipped.
+     */
+    static volatile uint32_t g_cmd_last[ eLED_NUM_OF ] = { 0 };
+
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+
+    /**
+     *     Trace ring
+     */
+    static volatile uint8_t g_trace_buf[ LED_CFG_TRACE_SIZE ] = { 0 };
+
+    /**
+     *     Trace ring write (handler) and read (drain) position
+     */
+    static volatile uint32_t g_trace_wr = 0U;
+    static volatile uint32_t g_trace_rd = 0U;
+
+    /**
+     *     Trace clock and tick of last recorded entry
+     *
+     * @note    Trace clock counts handler periods.
+     */
+    static uint32_t g_trace_tick = 0U;
+    static uint32_t g_trace_last = 0U;
+
+    #if ( 0 == LED_CFG_FIXED_POINT_EN )
+        static float32_t g_trace_rem = 0.0f;
+    #endif
+
+    /**
+     *     Number of entries lost due to full ring
+     */
+    static uint16_t g_trace_lost = 0U;
+
+#endif
+
+#if ( 1 == LED_CFG_PHASE_EN )
+
+    /**
+     *     Phase slot written by current handler call
+     *
+     * @note    At init all slots are written at once.
+     */
+    static uint8_t g_phase_slot = LED_PHASE_SLOT_ALL;
+
+    /**
+     *     Timer PWM LEDs with deferred write
+     */
+    static uint32_t g_phase_pending[ LED_PHASE_PENDING_NUM_OF ] = { 0 };
+
+    #if ( 1 == LED_CFG_GROUP_EN )
+
+        /**
+         *     Group membership changed, phase slots are re-assigned by
+         *     next handler call
+         */
+        static volatile bool g_phase_is_changed = false;
+
+    #endif
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
-/**
-*       Check that low level drivers are initialized
-*
-* @return       status - Status of low level initialization
-*/
+// Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static led_status_t led_check_drv_init(void)
-{
-    led_status_t status = eLED_OK;
+#if ( 1 == LED_PWM_USE_EN )
+    #if ( 1 == LED_CFG_FADE_LUT_EN )
+        static led_fade_pos_t   led_calc_fade_inc           (const led_time_t fade_time);
+        static led_fade_pos_t   led_calc_fade_pos_step      (const led_fade_pos_t fade_inc, const led_time_t dt);
+        static void             led_fade_pos_seek           (led_ctx_t * const p_ctx, const led_num_t num);
+    #else
+        static led_fade_k_t     led_calc_fade_k             (const led_duty_t max_duty, const led_time_t fade_time);
+        static led_duty_t       led_calc_fade_step          (const led_fade_k_t fade_k, const led_time_t time, const led_time_t dt);
+    #endif
 
-    #if ( 1 == LED_CFG_TIMER_USE_EN )
+    #if ( 1 == LED_FADE_PROFILE_EN )
+        static void             led_fade_profile_build      (led_ctx_t * const p_ctx, const uint8_t profile, const led_duty_t max_duty, const led_time_t fade_in_time, const led_time_t fade_out_time);
+        static bool             led_fade_profile_is_equal   (led_ctx_t * const p_ctx, const uint8_t profile, const led_duty_t max_duty, const led_time_t fade_in_time, const led_time_t fade_out_time);
+        static bool             led_fade_profile_acquire    (led_ctx_t * const p_ctx, const led_num_t num, const led_duty_t max_duty, const led_time_t fade_in_time, const led_time_t fade_out_time);
+    #endif
 
-        bool tim_drv_init = false;
+    static void         led_fade_in_hndl        (led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t exit_mode, const led_time_t dt);
+    static void         led_fade_out_hndl       (led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t exit_mode, const led_time_t dt);
+    static void         led_fade_blink_hndl     (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+#endif
 
-        // Get init flag
-        timer_is_init( &tim_drv_init );
+static void         led_blink_hndl          (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+static uint32_t     led_hndl_period_time    (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+static bool         led_is_on_time          (led_ctx_t * const p_ctx, const led_num_t num);
+static void         led_blink_cnt_hndl      (led_ctx_t * const p_ctx, const led_num_t num, const uint32_t per_cnt);
+static void         led_manage_time         (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+static led_time_t   led_get_deadline        (led_ctx_t * const p_ctx, const led_num_t num);
+static float32_t    led_get_rate            (led_ctx_t * const p_ctx, const led_num_t num);
+static bool         led_is_out_deferred     (led_ctx_t * const p_ctx);
+static bool         led_time_is_slow        (const led_time_t time);
+static void         led_hndl_single         (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+static void         led_hndl_time           (led_ctx_t * const p_ctx, const led_time_t dt);
+static void         led_activate            (led_ctx_t * const p_ctx, const led_num_t num);
+static void         led_mode_set            (led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode);
+static void         led_set_state           (led_ctx_t * const p_ctx, const led_num_t num, const led_state_t state);
+static void         led_blink_start         (led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode, const led_time_t on_time, const led_time_t period, const float32_t period_s, const led_blink_t blink);
+static void         led_group_fan_out       (led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode);
+static void         led_group_hndl          (led_ctx_t * const p_ctx, const led_time_t dt);
+static led_status_t led_check_cfg           (led_ctx_t * const p_ctx);
+static led_status_t led_check_drv_init      (led_ctx_t * const p_ctx);
+
+#if ( 1 == LED_CFG_GAMMA_EN )
+    static void         led_gamma_build     (void);
+    static led_duty_t   led_gamma_apply     (const led_duty_t duty);
+#endif
 
-        if ( false == tim_drv_init )
-        {
-            status |= eLED_ERROR_INIT;
-        }
+static bool         led_is_out_changed      (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t out);
+static void         led_refresh_hndl        (led_ctx_t * const p_ctx, const led_time_t dt);
+static void         led_limit_hndl          (led_ctx_t * const p_ctx);
+static void         led_gpio_port_flush     (led_ctx_t * const p_ctx);
+static void         led_frame_flush         (led_ctx_t * const p_ctx);
+static void         led_pixel_flush         (led_ctx_t * const p_ctx);
+static void         led_bcm_flush           (led_ctx_t * const p_ctx);
+static void         led_async_flush         (led_ctx_t * const p_ctx);
+static void         led_set_low             (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t duty_max);
+
+#if ( 1 == LED_CFG_GPIO_USE_EN )
+    static void     led_set_gpio            (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t duty_max);
+#endif
 
-    #endif
+#if ( 1 == LED_CFG_TIMER_USE_EN )
+    static void     led_set_timer           (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty);
+    static led_duty_t led_timer_duty_get    (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty);
+#endif
 
-    #if ( 1 == LED_CFG_GPIO_USE_EN )
+#if ( 1 == LED_CFG_TIMER_DMA_EN )
+    static void     led_dma_fade_hndl       (led_ctx_t * const p_ctx, const led_num_t num, const led_dma_wave_t wave);
+    static bool     led_dma_wave_build      (led_ctx_t * const p_ctx, const led_num_t num, const led_dma_wave_t wave, LED_CFG_TIMER_DMA_TYPE * const p_wave, uint32_t * const p_size);
+    static void     led_dma_release         (led_ctx_t * const p_ctx, const led_num_t num);
+#endif
 
-        bool gpio_drv_init = false;
+#if ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+    static void     led_set_gpio_port       (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t duty_max);
+#endif
 
-        // Get init flag
-        gpio_is_init( &gpio_drv_init );
+#if ( 1 == LED_CFG_FRAME_USE_EN )
+    static void     led_set_frame           (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t duty_max);
+#endif
 
-        if ( false == gpio_drv_init )
-        {
-            status |= eLED_ERROR_INIT;
-        }
+#if ( 1 == LED_CFG_PIXEL_USE_EN )
+    static void     led_set_pixel           (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty);
+    static void     led_pixel_encode        (const uint16_t idx);
+#endif
+
+#if ( 1 == LED_CFG_BCM_USE_EN )
+    static void     led_set_bcm             (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty);
+#endif
+
+#if ( 1 == LED_CFG_ASYNC_USE_EN )
+    static void     led_set_async           (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty);
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+    static void     led_stats_cycle_hndl    (led_ctx_t * const p_ctx, const uint32_t cycles);
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+    static bool         led_limit_load_set      (led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t max_duty);
+    static led_duty_t   led_limit_scale_calc    (led_ctx_t * const p_ctx);
+#endif
+
+#if ( 1 == LED_PWM_USE_EN )
+    static void     led_smooth_start        (led_ctx_t * const p_ctx, const led_num_t num, const led_state_t state);
+#endif
+
+#if ( 0 == LED_CFG_TIMESTAMP_EN )
+    static led_time_t   led_skip_dt         (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+    static led_status_t led_cmd_post        (const led_cmd_t * const p_cmd);
+    static void         led_cmd_exec        (led_ctx_t * const p_ctx, const led_cmd_t * const p_cmd);
+    static void         led_cmd_hndl        (led_ctx_t * const p_ctx);
+#endif
+
+#if ( 1 == LED_CFG_SEQ_EN )
+    static void         led_seq_hndl        (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+    static void         led_seq_loop        (led_ctx_t * const p_ctx, const led_num_t num, const led_seq_step_t * const p_step);
+    static led_duty_t   led_seq_ramp        (led_ctx_t * const p_ctx, const led_num_t num, const led_seq_step_t * const p_step, const led_duty_t target);
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+    static void     led_ramp_hndl           (led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt);
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+    static void     led_bulk_hndl           (led_ctx_t * const p_ctx);
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+    static void     led_event_hndl          (led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode);
+#endif
+
+#if ( 1 == LED_CFG_PHASE_EN )
+    static void     led_phase_assign        (led_ctx_t * const p_ctx);
+    static bool     led_phase_is_slot       (led_ctx_t * const p_ctx, const led_num_t num);
+    static void     led_phase_hndl          (led_ctx_t * const p_ctx);
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+    static void     led_trace_clock_hndl    (const led_time_t dt);
+    static void     led_trace_put           (const led_num_t num, const led_duty_t duty);
+    static uint32_t led_trace_varint        (uint8_t * const p_buf, uint32_t val);
+    static led_duty_t led_trace_out_duty    (led_ctx_t * const p_ctx, const led_num_t num, const led_duty_t out);
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+    static void     led_group_attach        (led_ctx_t * const p_ctx, const led_group_t group);
+#endif
+
+#if ( 1 == LED_CFG_TIMESTAMP_EN )
+    static led_time_t led_ts_elapsed        (led_ctx_t * const p_ctx);
+    static void     led_ts_period_start     (led_ctx_t * const p_ctx, const led_num_t num, const float32_t period);
+#endif
+
+#if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+    static void     led_active_time_fold    (led_ctx_t * const p_ctx, const led_num_t num);
+    static void     led_clock_hndl          (led_ctx_t * const p_ctx, const led_time_t dt);
 
+    #if !defined( __GNUC__ )
+        static uint32_t led_ctz             (const uint32_t value);
     #endif
+#endif
 
-    return status;
-}
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set LED via GPIO driver
-*
-*  @note    Based on duty cycle LED GPIO state is being determine!
+*       Manage LED timings
 *
-* @param[in]    led_num     - Number of LED
-* @param[in]    duty        - Current duty of LED
-* @param[in]    max_duty    - Maximum duty of LED
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - Number of LED
+* @param[in]    dt      - Elapsed time since last handler call
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void led_set_gpio(const led_num_t led_num, const float32_t duty, const float32_t max_duty)
+static void led_manage_time(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
 {
-    #if ( 1 == LED_CFG_GPIO_USE_EN )
+    if ( p_ctx->p_led[num].duty >= ( p_ctx->p_led[num].max_duty / 2 ))
+    {
+        p_ctx->p_led[num].active_time += dt;
+        p_ctx->p_led[num].active_time = LED_TIME_LIM( p_ctx->p_led[num].active_time );
+    }
+    else
+    {
+        p_ctx->p_led[num].active_time = 0;
+    }
+}
+
+#if ( 1 == LED_PWM_USE_EN )
 
-        gpio_state_t state = eGPIO_LOW;
+    #if ( 1 == LED_CFG_FADE_LUT_EN )
 
-        if ( duty >= max_duty )
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Calculate fading curve position increment
+        *
+        * @param[in]    fade_time   - Fading time
+        * @return       fade_inc    - Fading curve position increment per unit of time
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static led_fade_pos_t led_calc_fade_inc(const led_time_t fade_time)
         {
-            if ( eLED_POL_ACTIVE_LOW == gp_cfg_table[led_num].polarity )
+            led_fade_pos_t fade_inc = LED_FADE_POS_END;
+
+            if ( fade_time > 0 )
             {
-                state = eGPIO_LOW;
+                fade_inc = ( LED_FADE_POS_END / fade_time );
+
+                #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+                    // Fading must end
+                    if ( 0U == fade_inc )
+                    {
+                        fade_inc = 1U;
+                    }
+
+                #endif
             }
-            else
+
+            return fade_inc;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Calculate fading curve position step
+        *
+        * @param[in]    fade_inc    - Fading curve position increment per unit of time
+        * @param[in]    dt          - Elapsed time since last handler call
+        * @return       step        - Fading curve position change
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static led_fade_pos_t led_calc_fade_pos_step(const led_fade_pos_t fade_inc, const led_time_t dt)
+        {
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                return ( fade_inc * (( dt > LED_FADE_DT_LIM ) ? ( LED_FADE_DT_LIM ) : ( dt )));
+            #else
+                return ( fade_inc * dt );
+            #endif
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Set fading curve position based on current duty cycle
+        *
+        * @note     Shall be called on start of fading, as duty might be changed
+        *           outside of fading curve.
+        *
+        * @param[in]    p_ctx   - LED instance
+        * @param[in]    num     - LED number
+        * @return       void
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static void led_fade_pos_seek(led_ctx_t * const p_ctx, const led_num_t num)
+        {
+            const led_duty_t * const p_lut = p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ].lut;
+            uint32_t low    = 0U;
+            uint32_t high   = ( LED_CFG_FADE_LUT_SIZE - 1U );
+            uint32_t mid    = 0U;
+
+            // Find first point on curve equal or above current duty
+            while ( low < high )
             {
-                state = eGPIO_HIGH;
+                mid = (( low + high ) / 2U );
+
+                if ( p_lut[mid] < p_ctx->p_led[num].duty )
+                {
+                    low = ( mid + 1U );
+                }
+                else
+                {
+                    high = mid;
+                }
             }
+
+            p_ctx->p_led[num].fade_pos = LED_FADE_POS_FROM_IDX( low );
         }
-        else
+
+    #else
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Calculate fading factor
+        *
+        *  @note    Times two is becase of x^2 derivative is 2x
+        *
+        * @param[in]    max_duty    - Maximum duty cycle of LED
+        * @param[in]    fade_time   - Fading time
+        * @return       fade_k      - Fading factor
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static led_fade_k_t led_calc_fade_k(const led_duty_t max_duty, const led_time_t fade_time)
+        {
+            led_fade_k_t fade_k = 0;
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+                const led_time_t time = ( fade_time > 0U ) ? ( fade_time ) : ( LED_TIME_TICK );
+
+                fade_k = (led_fade_k_t) (( 2U * (uint32_t) max_duty << LED_FADE_K_FRAC ) / ( time * time ));
+
+                // Fading must end
+                if ( 0U == fade_k )
+                {
+                    fade_k = 1U;
+                }
+
+            #else
+                fade_k = (led_fade_k_t) ( 2.0f * max_duty / ( fade_time * fade_time ));
+            #endif
+
+            return fade_k;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Calculate fading duty step
+        *
+        * @param[in]    fade_k      - Fading factor
+        * @param[in]    time        - Fading time
+        * @param[in]    dt          - Elapsed time since last handler call
+        * @return       step        - Duty cycle change
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static led_duty_t led_calc_fade_step(const led_fade_k_t fade_k, const led_time_t time, const led_time_t dt)
         {
-            if ( eLED_POL_ACTIVE_LOW == gp_cfg_table[led_num].polarity )
+            led_duty_t step = 0;
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+                uint32_t step_32 = (( fade_k * time ) >> LED_FADE_K_FRAC );
+
+                // Limit in order to prevent overflow
+                step_32 = ( step_32 > LED_DUTY_MAX ) ? ( LED_DUTY_MAX ) : ( step_32 );
+                step_32 *= (( dt > LED_DUTY_MAX ) ? ( LED_DUTY_MAX ) : ( dt ));
+                step_32 = ( step_32 > LED_DUTY_MAX ) ? ( LED_DUTY_MAX ) : ( step_32 );
+
+                step = (led_duty_t) step_32;
+
+            #else
+                step = ( fade_k * time * dt );
+            #endif
+
+            return step;
+        }
+
+    #endif
+
+    #if ( 1 == LED_FADE_PROFILE_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Build fading profile
+        *
+        * @note     Float is used only here, as profile is built on configuration
+        *           change and not inside handler.
+        *
+        * @note     Without lookup table profile holds only fading factors.
+        *
+        * @param[in]    p_ctx           - LED instance
+        * @param[in]    profile         - Fading profile
+        * @param[in]    max_duty        - Maximum duty cycle
+        * @param[in]    fade_in_time    - Fade in time
+        * @param[in]    fade_out_time   - Fade out time
+        * @return       void
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static void led_fade_profile_build(led_ctx_t * const p_ctx, const uint8_t profile, const led_duty_t max_duty, const led_time_t fade_in_time, const led_time_t fade_out_time)
+        {
+            #if ( 1 == LED_CFG_FADE_LUT_EN )
+
+                float32_t x = 0.0f;
+
+                for ( uint32_t idx = 0; idx < LED_CFG_FADE_LUT_SIZE; idx++ )
+                {
+                    x = ((float32_t) idx / (float32_t) ( LED_CFG_FADE_LUT_SIZE - 1 ));
+
+                    p_ctx->fade_profile[profile].lut[idx] = LED_DUTY_FROM_F( LED_DUTY_TO_F( max_duty ) * x * x );
+                }
+
+                p_ctx->fade_profile[profile].in_inc      = led_calc_fade_inc( fade_in_time );
+                p_ctx->fade_profile[profile].out_inc     = led_calc_fade_inc( fade_out_time );
+
+            #else
+                p_ctx->fade_profile[profile].fade_in_k       = led_calc_fade_k( max_duty, fade_in_time );
+                p_ctx->fade_profile[profile].fade_out_k      = led_calc_fade_k( max_duty, fade_out_time );
+                p_ctx->fade_profile[profile].fade_out_time   = fade_out_time;
+            #endif
+
+            p_ctx->fade_profile[profile].max_duty    = max_duty;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Check if fading profile matches fading configuration
+        *
+        * @param[in]    p_ctx           - LED instance
+        * @param[in]    profile         - Fading profile
+        * @param[in]    max_duty        - Maximum duty cycle
+        * @param[in]    fade_in_time    - Fade in time
+        * @param[in]    fade_out_time   - Fade out time
+        * @return       is_equal        - Profile matches configuration
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static bool led_fade_profile_is_equal(led_ctx_t * const p_ctx, const uint8_t profile, const led_duty_t max_duty, const led_time_t fade_in_time, const led_time_t fade_out_time)
+        {
+            const led_fade_profile_t * const p_profile = &p_ctx->fade_profile[profile];
+
+            #if ( 1 == LED_CFG_FADE_LUT_EN )
+                return  (   ( max_duty == p_profile->max_duty )
+                        &&  ( led_calc_fade_inc( fade_in_time ) == p_profile->in_inc )
+                        &&  ( led_calc_fade_inc( fade_out_time ) == p_profile->out_inc ));
+            #else
+                return  (   ( max_duty == p_profile->max_duty )
+                        &&  ( led_calc_fade_k( max_duty, fade_in_time ) == p_profile->fade_in_k )
+                        &&  ( fade_out_time == p_profile->fade_out_time ));
+            #endif
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Acquire fading profile for LED
+        *
+        * @brief    LEDs with same fading configuration share single profile. If
+        *           there is no matching profile, new one is built on free slot.
+        *
+        * @param[in]    p_ctx           - LED instance
+        * @param[in]    num             - LED number
+        * @param[in]    max_duty        - Maximum duty cycle
+        * @param[in]    fade_in_time    - Fade in time
+        * @param[in]    fade_out_time   - Fade out time
+        * @return       is_acquired     - Profile acquired
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static bool led_fade_profile_acquire(led_ctx_t * const p_ctx, const led_num_t num, const led_duty_t max_duty, const led_time_t fade_in_time, const led_time_t fade_out_time)
+        {
+            const uint8_t           old         = p_ctx->p_led[num].fade_profile;
+            uint8_t                 profile     = LED_CFG_FADE_PROFILE_NUM_OF;
+            bool                    is_acquired = false;
+
+            // Release current profile (default is never released)
+            if ( LED_FADE_PROFILE_DEF != old )
+            {
+                p_ctx->fade_profile[old].ref_cnt--;
+            }
+
+            // Find matching profile
+            for ( uint8_t i = 0; i < LED_CFG_FADE_PROFILE_NUM_OF; i++ )
+            {
+                if  (   (( LED_FADE_PROFILE_DEF == i ) || ( p_ctx->fade_profile[i].ref_cnt > 0U ))
+                    &&  ( true == led_fade_profile_is_equal( p_ctx, i, max_duty, fade_in_time, fade_out_time )))
+                {
+                    profile = i;
+                    break;
+                }
+            }
+
+            // Build new profile on free slot
+            if ( LED_CFG_FADE_PROFILE_NUM_OF == profile )
+            {
+                for ( uint8_t i = ( LED_FADE_PROFILE_DEF + 1U ); i < LED_CFG_FADE_PROFILE_NUM_OF; i++ )
+                {
+                    if ( 0U == p_ctx->fade_profile[i].ref_cnt )
+                    {
+                        led_fade_profile_build( p_ctx, i, max_duty, fade_in_time, fade_out_time );
+                        profile = i;
+                        break;
+                    }
+                }
+            }
+
+            if ( profile < LED_CFG_FADE_PROFILE_NUM_OF )
+            {
+                is_acquired = true;
+            }
+
+            // No free profile - keep current one
+            else
+            {
+                profile = old;
+            }
+
+            if ( LED_FADE_PROFILE_DEF != profile )
+            {
+                p_ctx->fade_profile[profile].ref_cnt++;
+            }
+
+            p_ctx->p_led[num].fade_profile = profile;
+
+            return is_acquired;
+        }
+
+    #endif
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Fade in FMS state
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    num         - LED number
+    * @param[in]    exit_mode   - Mode to transition on exit
+    * @param[in]    dt          - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_fade_in_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t exit_mode, const led_time_t dt)
+    {
+        #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+            // Stream fading curve by timer DMA
+            led_dma_fade_hndl( p_ctx, num, eLED_DMA_WAVE_FADE_IN );
+
+        #endif
+
+        #if ( 1 == LED_CFG_FADE_LUT_EN )
+
+            const led_fade_profile_t * const p_profile = &p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ];
+
+            // Move forward on fading curve
+            const led_fade_pos_t step = led_calc_fade_pos_step( p_profile->in_inc, dt );
+
+            // Is LED fully ON?
+            if ( step < ( LED_FADE_POS_END - p_ctx->p_led[num].fade_pos ))
+            {
+                p_ctx->p_led[num].fade_pos += step;
+                p_ctx->p_led[num].duty = p_profile->lut[ LED_FADE_POS_TO_IDX( p_ctx->p_led[num].fade_pos ) ];
+            }
+
+            // LED fully ON
+            else
+            {
+                // Limit duty
+                p_ctx->p_led[num].fade_pos = LED_FADE_POS_END;
+                p_ctx->p_led[num].duty = p_ctx->p_led[num].max_duty;
+
+                // Goto NORMAL mode
+                led_mode_set( p_ctx, num, exit_mode );
+            }
+
+        #else
+
+            #if ( 1 == LED_FADE_PROFILE_EN )
+                const led_fade_profile_t * const p_fade = &p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ];
+            #else
+                const led_t * const p_fade = &p_ctx->p_led[num];
+            #endif
+
+            // Increase duty by the square function
+            const led_duty_t step = led_calc_fade_step( p_fade->fade_in_k, p_ctx->p_led[num].fade_time, dt );
+
+            // Is LED fully ON?
+            if  (   ( p_ctx->p_led[num].duty < p_ctx->p_led[num].max_duty )
+                &&  ( step <= ( p_ctx->p_led[num].max_duty - p_ctx->p_led[num].duty )))
+            {
+                p_ctx->p_led[num].duty += step;
+
+                // Increment time
+                p_ctx->p_led[num].fade_time += dt;
+                p_ctx->p_led[num].fade_time = LED_TIME_LIM( p_ctx->p_led[num].fade_time );
+            }
+
+            // LED fully ON
+            else
+            {
+                // Limit duty
+                p_ctx->p_led[num].duty = p_ctx->p_led[num].max_duty;
+
+                // Reset time
+                p_ctx->p_led[num].fade_time = 0;
+
+                // Goto NORMAL mode
+                led_mode_set( p_ctx, num, exit_mode );
+            }
+
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Fade out FMS state
+    *
+    * @param[in]    p_ctx          - LED instance
+    * @param[in]    num            - LED number
+    * @param[in]    exit_mode    - Mode to transition on exit
+    * @param[in]    dt          - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_fade_out_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t exit_mode, const led_time_t dt)
+    {
+        #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+            // Stream fading curve by timer DMA
+            led_dma_fade_hndl( p_ctx, num, eLED_DMA_WAVE_FADE_OUT );
+
+        #endif
+
+        #if ( 1 == LED_CFG_FADE_LUT_EN )
+
+            const led_fade_profile_t * const p_profile = &p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ];
+
+            // Move backward on fading curve
+            const led_fade_pos_t step = led_calc_fade_pos_step( p_profile->out_inc, dt );
+
+            // Is LED fully OFF?
+            if ( step < p_ctx->p_led[num].fade_pos )
+            {
+                p_ctx->p_led[num].fade_pos -= step;
+                p_ctx->p_led[num].duty = p_profile->lut[ LED_FADE_POS_TO_IDX( p_ctx->p_led[num].fade_pos ) ];
+            }
+
+            // LED fully OFF
+            else
+            {
+                // Limit duty
+                p_ctx->p_led[num].fade_pos = 0;
+                p_ctx->p_led[num].duty = 0;
+
+                // Goto NORMAL mode
+                led_mode_set( p_ctx, num, exit_mode );
+            }
+
+        #else
+
+            #if ( 1 == LED_FADE_PROFILE_EN )
+                const led_fade_profile_t * const p_fade = &p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ];
+            #else
+                const led_t * const p_fade = &p_ctx->p_led[num];
+            #endif
+
+            led_time_t time = 0;
+            led_duty_t step = 0;
+
+            // Calculate negative time in order to get square characteristics in negative time domain
+            if ( p_fade->fade_out_time > p_ctx->p_led[num].fade_time )
+            {
+                time = ( p_fade->fade_out_time - p_ctx->p_led[num].fade_time );
+            }
+
+            // Watch out for end of negative characteristics
+            step = led_calc_fade_step( p_fade->fade_out_k, time, dt );
+
+            if  (   ( time > 0 )
+                &&  ( step < p_ctx->p_led[num].duty ))
+            {
+                p_ctx->p_led[num].duty -= step;
+            }
+            else
+            {
+                p_ctx->p_led[num].duty = 0;
+            }
+
+            // Is LED fully OFF?
+            if ( p_ctx->p_led[num].duty > LED_FADE_OUT_DUTY_LIM )
+            {
+                // Increment time
+                p_ctx->p_led[num].fade_time += dt;
+                p_ctx->p_led[num].fade_time = LED_TIME_LIM( p_ctx->p_led[num].fade_time );
+            }
+
+            // LED fully OFF
+            else
+            {
+                // Limit duty
+                p_ctx->p_led[num].duty = 0;
+
+                // Reset time
+                p_ctx->p_led[num].fade_time = 0;
+
+                // Goto NORMAL mode
+                led_mode_set( p_ctx, num, exit_mode );
+            }
+
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       LED fade blink FSM state
+    *
+    * @param[in]    p_ctx          - LED instance
+    * @param[in]    num            - LED number
+    * @param[in]    dt          - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_fade_blink_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+    {
+        // Manage period time & blink counter
+        led_blink_cnt_hndl( p_ctx, num, led_hndl_period_time( p_ctx, num, dt ));
+
+        if ( eLED_MODE_FADE_BLINK == p_ctx->p_led[num].mode )
+        {
+            if ( true == led_is_on_time( p_ctx, num ))
+            {
+                led_fade_in_hndl( p_ctx, num , eLED_MODE_FADE_BLINK, dt );
+            }
+            else
+            {
+                led_fade_out_hndl( p_ctx, num, eLED_MODE_FADE_BLINK, dt );
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Start streaming of fading curve by timer DMA
+    *
+    * @brief    On start of fading whole fading curve is pre-computed into
+    *           waveform buffer and streamed into timer compare register,
+    *           thus timer is not written by handler until end of fading.
+    *
+    * @note     LED is faded by handler when there is no free waveform buffer,
+    *           waveform does not fit into it or LED is part of additional
+    *           instance.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    wave    - Fading waveform
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_dma_fade_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_dma_wave_t wave)
+    {
+        uint32_t size = 0U;
+
+        // Start of timer PWM LED fading
+        if  (   ( true == LED_CTX_IS_DEF( p_ctx ))
+            &&  ( num < p_ctx->num_of )
+            &&  ( eLED_DRV_TIMER_PWM == p_ctx->p_cfg[num].drv_type )
+            &&  ( (uint8_t) wave != p_ctx->p_led[num].dma_wave ))
+        {
+            p_ctx->p_led[num].dma_wave = (uint8_t) wave;
+
+            // Acquire waveform buffer
+            if ( LED_DMA_BUF_NONE == p_ctx->p_led[num].dma_buf )
+            {
+                for ( uint8_t buf = 0; buf < LED_CFG_TIMER_DMA_NUM_OF; buf++ )
+                {
+                    if ( 0U == ( g_dma_used & ( 1UL << buf )))
+                    {
+                        g_dma_used |= ( 1UL << buf );
+                        p_ctx->p_led[num].dma_buf = buf;
+                        break;
+                    }
+                }
+            }
+
+            // Abort running waveform before rebuild
+            else
+            {
+                LED_CFG_TIMER_DMA_STOP( p_ctx->p_cfg[num].drv_ch.tim_ch );
+            }
+
+            if ( LED_DMA_BUF_NONE != p_ctx->p_led[num].dma_buf )
+            {
+                if ( true == led_dma_wave_build( p_ctx, num, wave, g_dma_wave[ p_ctx->p_led[num].dma_buf ], &size ))
+                {
+                    LED_CFG_TIMER_DMA_START( p_ctx->p_cfg[num].drv_ch.tim_ch, g_dma_wave[ p_ctx->p_led[num].dma_buf ], size );
+                    LED_STATS_INC( timer_cnt );
+                }
+
+                // Waveform too long - fade by handler
+                else
+                {
+                    led_dma_release( p_ctx, num );
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Build fading waveform
+    *
+    * @note     Fading curve is sampled from current LED fading state with
+    *           same characteristics as used by fading handlers. Float is
+    *           used only here, as waveform is built on start of fading.
+    *
+    * @note     Last sample holds final duty of fading.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    wave    - Fading waveform
+    * @param[out]   p_wave  - Timer compare values
+    * @param[out]   p_size  - Number of samples
+    * @return       is_end  - Whole fading fits into waveform buffer
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool led_dma_wave_build(led_ctx_t * const p_ctx, const led_num_t num, const led_dma_wave_t wave, LED_CFG_TIMER_DMA_TYPE * const p_wave, uint32_t * const p_size)
+    {
+        const bool      is_fade_in  = ( eLED_DMA_WAVE_FADE_IN == wave );
+        const float32_t target      = ( true == is_fade_in ) ? ((float32_t) p_ctx->p_led[num].max_duty ) : ( 0.0f );
+        float32_t       duty        = (float32_t) p_ctx->p_led[num].duty;
+        led_duty_t      sample      = 0;
+        uint32_t        size        = 0U;
+        bool            is_end      = false;
+
+        #if ( 1 == LED_CFG_FADE_LUT_EN )
+
+            const led_fade_profile_t * const p_profile = &p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ];
+            const float32_t inc = (float32_t) (( true == is_fade_in ) ? ( p_profile->in_inc ) : ( p_profile->out_inc )) * LED_DMA_SAMPLE_TIME;
+            float32_t       pos = (float32_t) p_ctx->p_led[num].fade_pos;
+
+        #else
+
+            #if ( 1 == LED_FADE_PROFILE_EN )
+                const led_fade_profile_t * const p_fade = &p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ];
+            #else
+                const led_t * const p_fade = &p_ctx->p_led[num];
+            #endif
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                const float32_t k = (float32_t) (( true == is_fade_in ) ? ( p_fade->fade_in_k ) : ( p_fade->fade_out_k )) / (float32_t) ( 1UL << LED_FADE_K_FRAC );
+            #else
+                const float32_t k = (( true == is_fade_in ) ? ( p_fade->fade_in_k ) : ( p_fade->fade_out_k ));
+            #endif
+
+            const float32_t duty_0      = duty;
+            const float32_t time_0      = (float32_t) p_ctx->p_led[num].fade_time;
+            const float32_t time_end    = (float32_t) p_fade->fade_out_time - time_0;
+            float32_t       time        = 0.0f;
+
+        #endif
+
+        while (( false == is_end ) && ( size < LED_CFG_TIMER_DMA_SIZE ))
+        {
+            #if ( 1 == LED_CFG_FADE_LUT_EN )
+
+                // Move on fading curve
+                pos = ( true == is_fade_in ) ? ( pos + inc ) : ( pos - inc );
+
+                if  (   ( pos >= (float32_t) LED_FADE_POS_END )
+                    ||  ( pos <= 0.0f ))
+                {
+                    is_end = true;
+                }
+                else
+                {
+                    duty = (float32_t) p_profile->lut[ LED_FADE_POS_TO_IDX( (led_fade_pos_t) pos ) ];
+                }
+
+            #else
+
+                time += LED_DMA_SAMPLE_TIME;
+
+                // Square function
+                if ( true == is_fade_in )
+                {
+                    duty = duty_0 + 0.5f * k * (( time_0 + time ) * ( time_0 + time ) - ( time_0 * time_0 ));
+                    is_end = ( duty >= target );
+                }
+
+                // Square function in negative time domain
+                else if ( time < time_end )
+                {
+                    duty = duty_0 - k * ( time_end * time - 0.5f * time * time );
+                    is_end = ( duty <= (float32_t) LED_FADE_OUT_DUTY_LIM );
+                }
+                else
+                {
+                    is_end = true;
+                }
+
+            #endif
+
+            if ( true == is_end )
+            {
+                duty = target;
+            }
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                sample = (led_duty_t) ( duty + 0.5f );
+            #else
+                sample = (led_duty_t) duty;
+            #endif
+
+            p_wave[size] = (LED_CFG_TIMER_DMA_TYPE) ( LED_DUTY_TO_F( led_timer_duty_get( p_ctx, num, sample )) * (float32_t) LED_CFG_TIMER_DMA_PERIOD + 0.5f );
+            size++;
+        }
+
+        *p_size = size;
+
+        return is_end;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Release timer DMA waveform of LED
+    *
+    * @note     Output is re-written by handler on next pass!
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_dma_release(led_ctx_t * const p_ctx, const led_num_t num)
+    {
+        if ( LED_DMA_BUF_NONE != p_ctx->p_led[num].dma_buf )
+        {
+            LED_CFG_TIMER_DMA_STOP( p_ctx->p_cfg[num].drv_ch.tim_ch );
+
+            g_dma_used &= ~( 1UL << p_ctx->p_led[num].dma_buf );
+            p_ctx->p_led[num].dma_buf  = LED_DMA_BUF_NONE;
+            p_ctx->p_led[num].is_dirty = true;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       LED blink FSM state
+*
+* @param[in]    p_ctx          - LED instance
+* @param[in]    num            - LED number
+* @param[in]    dt          - Elapsed time since last handler call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_blink_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+{
+    // Manage period time & blink counter
+    led_blink_cnt_hndl( p_ctx, num, led_hndl_period_time( p_ctx, num, dt ));
+
+    if  (   ( eLED_MODE_BLINK == p_ctx->p_led[num].mode )
+        &&  ( true == led_is_on_time( p_ctx, num )))
+    {
+        p_ctx->p_led[num].duty = p_ctx->p_led[num].max_duty;
+    }
+    else
+    {
+        p_ctx->p_led[num].duty = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Period time handler
+*
+* @note     Period overshoot is kept in order to prevent drift of period
+*           when handler is called with variable elapsed time.
+*
+* @note     With absolute time keeping period phase is calculated from
+*           timestamp of period start, elapsed time is not used.
+*
+* @note     Without absolute time keeping first period starts on first handler
+*           call after blink start, as part of elapsed time of that call is
+*           before blink start.
+*
+* @param[in]    p_ctx       - LED instance
+* @param[in]    num         - LED number
+* @param[in]    dt          - Elapsed time since last handler call
+* @return       per_cnt     - Number of elapsed periods
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t led_hndl_period_time(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+{
+    uint32_t per_cnt = 0U;
+
+#if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+    const uint32_t elapsed = ( p_ctx->ts_now - p_ctx->p_led[num].per_start );
+
+    (void) dt;
+
+    // Move period start by whole elapsed periods
+    if ( elapsed >= p_ctx->p_led[num].period_ts )
+    {
+        per_cnt = ( elapsed / p_ctx->p_led[num].period_ts );
+        p_ctx->p_led[num].per_start += ( per_cnt * p_ctx->p_led[num].period_ts );
+    }
+
+    p_ctx->p_led[num].per_time = LED_TIME_FROM_TS( p_ctx->ts_now - p_ctx->p_led[num].per_start );
+
+#else
+
+    p_ctx->p_led[num].per_time += led_skip_dt( p_ctx, num, dt );
+
+    if (( p_ctx->p_led[num].per_time + LED_TIME_EPS ) >= p_ctx->p_led[num].period )
+    {
+        p_ctx->p_led[num].per_time -= p_ctx->p_led[num].period;
+        per_cnt = 1U;
+
+        // Multiple periods elapsed
+        if ( p_ctx->p_led[num].per_time >= p_ctx->p_led[num].period )
+        {
+            per_cnt += (uint32_t) ( p_ctx->p_led[num].per_time / p_ctx->p_led[num].period );
+            p_ctx->p_led[num].per_time -= ((led_time_t) ( per_cnt - 1U ) * p_ctx->p_led[num].period );
+        }
+    }
+
+#endif
+
+    return per_cnt;
+}
+
+#if ( 0 == LED_CFG_TIMESTAMP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get elapsed time after blink or sequence start
+    *
+    * @note     Part of elapsed time of first handler call after start is
+    *           before start. Whole elapsed time is skipped, or elapsed time
+    *           above one handler period when handler call in one handler
+    *           period was requested by "led_get_next_deadline()".
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    dt      - Elapsed time since last handler call
+    * @return       dt      - Elapsed time after start
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_time_t led_skip_dt(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+    {
+        led_time_t skip_dt = dt;
+
+        if ( eLED_PER_SKIP_ALL == p_ctx->p_led[num].per_skip )
+        {
+            skip_dt = 0;
+        }
+        else if ( eLED_PER_SKIP_TICK == p_ctx->p_led[num].per_skip )
+        {
+            skip_dt = (( dt > LED_TIME_TICK ) ? ( dt - LED_TIME_TICK ) : ( 0 ));
+        }
+        else
+        {
+            // No action...
+        }
+
+        p_ctx->p_led[num].per_skip = eLED_PER_SKIP_NONE;
+
+        return skip_dt;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if it is time for ON LED state
+*
+* @param[in]    p_ctx          - LED instance
+* @param[in]    num            - LED number
+* @return       is_on_time    - Is currently LED on or off
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_is_on_time(led_ctx_t * const p_ctx, const led_num_t num)
+{
+    bool is_on_time = false;
+
+    if (( p_ctx->p_led[num].per_time + LED_TIME_EPS ) < p_ctx->p_led[num].on_time )
+    {
+        is_on_time = true;
+    }
+
+    return is_on_time;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Manage blink counter
+*
+* @param[in]    p_ctx      - LED instance
+* @param[in]    num        - LED number
+* @param[in]    per_cnt    - Number of elapsed blink periods
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_blink_cnt_hndl(led_ctx_t * const p_ctx, const led_num_t num, const uint32_t per_cnt)
+{
+    // On blink period
+    if ( per_cnt > 0U )
+    {
+        // Not continuous blinking
+        if ( LED_BLINK_CNT_CONT_VAL != p_ctx->p_led[num].blink_cnt )
+        {
+            // Blink count expire
+            if ( per_cnt > p_ctx->p_led[num].blink_cnt )
+            {
+                p_ctx->p_led[num].blink_cnt = 0;
+                led_mode_set( p_ctx, num, eLED_MODE_NORMAL );
+            }
+
+            // Decrease blink counts
+            else
+            {
+                p_ctx->p_led[num].blink_cnt -= (uint8_t) per_cnt;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get time until LED needs next handler call
+*
+* @note     Blink started after last handler call requests handler call
+*           in one handler period. Elapsed time above that period on next
+*           handler call is counted into first blink period.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED number
+* @return       time    - Time till next LED state change
+*/
+////////////////////////////////////////////////////////////////////////////////
+static led_time_t led_get_deadline(led_ctx_t * const p_ctx, const led_num_t num)
+{
+    led_time_t time = LED_TIME_LIMIT;
+
+    switch( p_ctx->p_led[num].mode )
+    {
+        case eLED_MODE_FADE_IN:
+        case eLED_MODE_FADE_OUT:
+        case eLED_MODE_FADE_BLINK:
+        #if ( 1 == LED_CFG_RAMP_EN )
+            case eLED_MODE_RAMP:
+        #endif
+            // Fading needs constant handler period
+            time = LED_TIME_TICK;
+            break;
+
+        case eLED_MODE_BLINK:
+            if ( true == led_is_on_time( p_ctx, num ))
+            {
+                time = ( p_ctx->p_led[num].on_time - p_ctx->p_led[num].per_time );
+            }
+            else
+            {
+                time = ( p_ctx->p_led[num].period - p_ctx->p_led[num].per_time );
+            }
+
+            #if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+                // Output of current blink phase not written yet (e.g. right after blink start)
+                if ( led_is_on_time( p_ctx, num ) != ( 0 != p_ctx->p_led[num].duty ))
+                {
+                    time = LED_TIME_TICK;
+                }
+
+            #else
+
+                // First period starts on next handler call
+                if ( eLED_PER_SKIP_NONE != p_ctx->p_led[num].per_skip )
+                {
+                    time = LED_TIME_TICK;
+                }
+
+            #endif
+            break;
+
+        #if ( 1 == LED_CFG_SEQ_EN )
+            case eLED_MODE_SEQUENCE:
+                if ( eLED_SEQ_OP_SET == p_ctx->p_led[num].p_seq[ p_ctx->p_led[num].seq_pc ].op )
+                {
+                    time = (((led_time_t) p_ctx->p_led[num].p_seq[ p_ctx->p_led[num].seq_pc ].time * LED_TIME_TICK ) - p_ctx->p_led[num].seq_time );
+
+                    // Duty of set step not written yet (e.g. right after sequence start)
+                    if ( p_ctx->p_led[num].duty != LED_DUTY_SCALE( LED_DUTY_FROM_U8( p_ctx->p_led[num].p_seq[ p_ctx->p_led[num].seq_pc ].duty ), p_ctx->p_led[num].max_duty ))
+                    {
+                        time = LED_TIME_TICK;
+                    }
+                }
+                else
+                {
+                    time = LED_TIME_TICK;
+                }
+
+                #if ( 0 == LED_CFG_TIMESTAMP_EN )
+
+                    // First step starts on next handler call
+                    if ( eLED_PER_SKIP_NONE != p_ctx->p_led[num].per_skip )
+                    {
+                        time = LED_TIME_TICK;
+                    }
+
+                #endif
+                break;
+        #endif
+
+        case eLED_MODE_NORMAL:
+        case eLED_MODE_FADE_TOGGLE:
+        case eLED_MODE_GROUP:
+        default:
+            // No action...
+            break;
+    }
+
+    #if ( 0 == LED_CFG_TIMESTAMP_EN )
+
+        // Handler call in one handler period is requested from now on
+        if ( eLED_PER_SKIP_ALL == p_ctx->p_led[num].per_skip )
+        {
+            p_ctx->p_led[num].per_skip = eLED_PER_SKIP_TICK;
+        }
+
+    #endif
+
+    return time;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get handler rate required by LED
+*
+* @brief    Fading, ramps and sequences needs handler period of "LED_CFG_HNDL_PERIOD_S".
+*           Blinking with ON and OFF times of multiple of slow handler period
+*           needs only slow handler rate, as blink timing is kept with real
+*           elapsed time.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED number
+* @return       rate    - Required handler rate in Hz, zero when LED is static
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t led_get_rate(led_ctx_t * const p_ctx, const led_num_t num)
+{
+    float32_t rate = 0.0f;
+
+    switch( p_ctx->p_led[num].mode )
+    {
+        case eLED_MODE_FADE_IN:
+        case eLED_MODE_FADE_OUT:
+        case eLED_MODE_FADE_BLINK:
+        #if ( 1 == LED_CFG_SEQ_EN )
+            case eLED_MODE_SEQUENCE:
+        #endif
+        #if ( 1 == LED_CFG_RAMP_EN )
+            case eLED_MODE_RAMP:
+        #endif
+            rate = LED_HNDL_FREQ_HZ;
+            break;
+
+        case eLED_MODE_BLINK:
+            if  (   ( true == led_time_is_slow( p_ctx->p_led[num].on_time ))
+                &&  ( true == led_time_is_slow( p_ctx->p_led[num].period )))
+            {
+                rate = LED_HNDL_SLOW_FREQ_HZ;
+            }
+            else
+            {
+                rate = LED_HNDL_FREQ_HZ;
+            }
+            break;
+
+        case eLED_MODE_NORMAL:
+        case eLED_MODE_FADE_TOGGLE:
+        case eLED_MODE_GROUP:
+        default:
+            // No action...
+            break;
+    }
+
+    return rate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if driver output of instance is deferred
+*
+* @brief    Changes written while frame, pixel stream or asynchronous batch
+*           transfer is in progress are coalesced and sent by next handler
+*           call after transfer completes. Timer PWM LEDs written outside
+*           of their phase slot are written in their slot.
+*
+* @param[in]    p_ctx       - LED instance
+* @return       is_deferred - Handler call is needed to send pending output
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_is_out_deferred(led_ctx_t * const p_ctx)
+{
+    bool is_deferred = false;
+
+    if ( true == LED_CTX_IS_DEF( p_ctx ))
+    {
+        #if ( 1 == LED_CFG_FRAME_USE_EN )
+
+            if  (   ( true == gb_frame_is_changed )
+                ||  ( true == gb_frame_tx_busy ))
+            {
+                is_deferred = true;
+            }
+
+        #endif
+
+        #if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+            if ( true == gb_pixel_tx_busy )
+            {
+                is_deferred = true;
+            }
+
+            for ( uint32_t word = 0; word < LED_PIXEL_DIRTY_NUM_OF; word++ )
+            {
+                if ( 0U != g_pixel_dirty[word] )
+                {
+                    is_deferred = true;
+                }
+            }
+
+        #endif
+
+        #if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+            if ( true == gb_async_busy )
+            {
+                is_deferred = true;
+            }
+
+            for ( uint32_t word = 0; word < LED_ASYNC_DIRTY_NUM_OF; word++ )
+            {
+                if ( 0U != g_async_dirty[word] )
+                {
+                    is_deferred = true;
+                }
+            }
+
+        #endif
+
+        #if ( 1 == LED_CFG_PHASE_EN )
+
+            for ( uint32_t word = 0; word < LED_PHASE_PENDING_NUM_OF; word++ )
+            {
+                if ( 0U != g_phase_pending[word] )
+                {
+                    is_deferred = true;
+                }
+            }
+
+        #endif
+    }
+
+    return is_deferred;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if time is multiple of slow handler period
+*
+* @param[in]    time    - LED time
+* @return       true if time can be kept with slow handler period
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_time_is_slow(const led_time_t time)
+{
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+        const led_time_t slow = LED_TIME_FROM_S( LED_HNDL_SLOW_PERIOD_S );
+
+        return (( slow > 0U ) && ( 0U == ( time % slow )));
+
+    #else
+
+        const float32_t n       = ( time * LED_HNDL_SLOW_FREQ_HZ );
+        const float32_t diff    = ( n - (float32_t)(uint32_t)( n + 0.5f ));
+
+        return (( diff < 1E-3f ) && ( diff > -1E-3f ));
+
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle single LED
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED number
+* @param[in]    dt      - Elapsed time since last handler call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_hndl_single(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+{
+    // Mode at start of handler call
+    const led_mode_t mode = (led_mode_t) p_ctx->p_led[num].mode;
+
+    switch( p_ctx->p_led[num].mode )
+    {
+        case eLED_MODE_NORMAL:
+        case eLED_MODE_FADE_TOGGLE:
+        case eLED_MODE_GROUP:
+            // No action...
+            break;
+
+        case eLED_MODE_BLINK:
+            led_blink_hndl( p_ctx, num, dt );
+            break;
+
+        #if ( 1 == LED_PWM_USE_EN )
+            case eLED_MODE_FADE_IN:
+                led_fade_in_hndl( p_ctx, num, eLED_MODE_NORMAL, dt );
+                break;
+
+            case eLED_MODE_FADE_OUT:
+                led_fade_out_hndl( p_ctx, num, eLED_MODE_NORMAL, dt );
+                break;
+
+            case eLED_MODE_FADE_BLINK:
+                led_fade_blink_hndl( p_ctx, num, dt );
+                break;
+        #endif
+
+        #if ( 1 == LED_CFG_SEQ_EN )
+            case eLED_MODE_SEQUENCE:
+                led_seq_hndl( p_ctx, num, dt );
+                break;
+        #endif
+
+        #if ( 1 == LED_CFG_RAMP_EN )
+            case eLED_MODE_RAMP:
+                led_ramp_hndl( p_ctx, num, dt );
+                break;
+        #endif
+
+        case eLED_MODE_NUM_OF:
+        default:
+            LED_ASSERT( 0 );
+            break;
+    }
+
+    if ( num < p_ctx->num_of )
+    {
+        #if ( 1 == LED_CFG_EVENT_EN )
+
+            // LED returned to normal mode - callback may already set new LED state
+            if  (   ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode )
+                &&  ( eLED_MODE_NORMAL != mode ))
+            {
+                led_event_hndl( p_ctx, num, mode );
+            }
+
+        #endif
+
+        // Set LED low level driver
+        led_set_low( p_ctx, num, p_ctx->p_led[num].duty, p_ctx->p_led[num].max_duty );
+
+        // Manage LED timings
+        led_manage_time( p_ctx, num, dt );
+    }
+
+    // Group state machine
+    else
+    {
+        led_group_fan_out( p_ctx, num, mode );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle all LEDs
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    dt      - Elapsed time since last handler call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_hndl_time(led_ctx_t * const p_ctx, const led_time_t dt)
+{
+    #if ( 1 == LED_CFG_STATS_EN )
+        const uint32_t cycle_start = LED_CFG_STATS_CYCLE_GET();
+    #endif
+
+    #if ( 1 == LED_CFG_TRACE_EN )
+
+        // Advance trace clock
+        led_trace_clock_hndl( dt );
+
+    #endif
+
+    #if ( 1 == LED_CFG_BULK_EN )
+
+        // Apply staged LED states at once, before posted commands
+        led_bulk_hndl( p_ctx );
+
+    #endif
+
+    #if ( 1 == LED_CFG_CMD_QUEUE_EN )
+
+        // Execute posted commands
+        if ( true == LED_CTX_IS_DEF( p_ctx ))
+        {
+            led_cmd_hndl( p_ctx );
+        }
+
+    #endif
+
+    #if (( 1 == LED_CFG_PHASE_EN ) && ( 1 == LED_CFG_GROUP_EN ))
+
+        // Re-assign phase slots after change of group membership
+        if ( true == g_phase_is_changed )
+        {
+            g_phase_is_changed = false;
+            LED_CFG_CMD_BARRIER();
+
+            led_phase_assign( p_ctx );
+        }
+
+    #endif
+
+    // Force driver refresh
+    led_refresh_hndl( p_ctx, dt );
+
+    // Run group state machines before members
+    if ( true == LED_CTX_IS_DEF( p_ctx ))
+    {
+        led_group_hndl( p_ctx, dt );
+    }
+
+    #if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+        // Advance active list clock
+        led_clock_hndl( p_ctx, dt );
+
+        // Loop through active LEDs only
+        for ( uint32_t word = 0; word < LED_ACTIVE_NUM_OF; word++ )
+        {
+            uint32_t active = p_ctx->active[word];
+
+            while ( 0U != active )
+            {
+                const led_num_t led_num = (led_num_t) (( word * 32U ) + LED_CTZ( active ));
+
+                active &= ( active - 1U );
+
+                // Active bits are set only for LEDs
+                if ( led_num >= p_ctx->num_of )
+                {
+                    break;
+                }
+
+                led_hndl_single( p_ctx, led_num, dt );
+
+                // LED became idle
+                if ( eLED_MODE_NORMAL == p_ctx->p_led[led_num].mode )
+                {
+                    p_ctx->active[word] &= ~( 1UL << ( led_num & 0x1FU ));
+                    p_ctx->p_led[led_num].idle_mark = p_ctx->clock;
+                }
+            }
+        }
+
+    #else
+
+        // Loop through all LEDs
+        for ( led_num_t led_num = 0; led_num < p_ctx->num_of; led_num++ )
+        {
+            led_hndl_single( p_ctx, led_num, dt );
+        }
+
+    #endif
+
+    // Scale dimmable LEDs to current budget
+    led_limit_hndl( p_ctx );
+
+    #if ( 1 == LED_CFG_PHASE_EN )
+
+        // Write deferred timer PWM LEDs of current phase slot
+        led_phase_hndl( p_ctx );
+
+    #endif
+
+    // Buffered low level drivers are used by default instance only
+    if ( true == LED_CTX_IS_DEF( p_ctx ))
+    {
+        // Write GPIO ports
+        led_gpio_port_flush( p_ctx );
+
+        // Send frame
+        led_frame_flush( p_ctx );
+
+        // Send pixels
+        led_pixel_flush( p_ctx );
+
+        // Rebuild BCM schedule
+        led_bcm_flush( p_ctx );
+
+        // Submit changed asynchronous driver channels
+        led_async_flush( p_ctx );
+    }
+
+    #if ( 1 == LED_CFG_STATS_EN )
+        led_stats_cycle_hndl( p_ctx, (uint32_t) ( LED_CFG_STATS_CYCLE_GET() - cycle_start ));
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Change LED mode
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED number
+* @param[in]    mode    - New LED mode
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_mode_set(led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode)
+{
+    if ( mode != p_ctx->p_led[num].mode )
+    {
+        p_ctx->p_led[num].mode = mode;
+
+        // Group state machines have no statistics, statistics are sized
+        // by maximum number of LEDs of instance
+        if  (   ( num < p_ctx->num_of )
+            &&  ( num < LED_CFG_CTX_LED_NUM_OF ))
+        {
+            LED_STATS_INC( mode_cnt[num] );
+        }
+
+        #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+            // End of fading - timer is written by handler again
+            if  (   ( eLED_MODE_FADE_IN != mode )
+                &&  ( eLED_MODE_FADE_OUT != mode )
+                &&  ( eLED_MODE_FADE_BLINK != mode ))
+            {
+                led_dma_release( p_ctx, num );
+                p_ctx->p_led[num].dma_wave = eLED_DMA_WAVE_NONE;
+            }
+
+        #endif
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set LED state
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED number
+* @param[in]    state   - State of LED
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_set_state(led_ctx_t * const p_ctx, const led_num_t num, const led_state_t state)
+{
+    led_activate( p_ctx, num );
+
+    led_mode_set( p_ctx, num, eLED_MODE_NORMAL );
+
+    if ( eLED_ON == state )
+    {
+        p_ctx->p_led[num].duty = p_ctx->p_led[num].max_duty;
+    }
+    else
+    {
+        p_ctx->p_led[num].duty = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start LED blinking
+*
+* @param[in]    p_ctx       - LED instance
+* @param[in]    num         - LED number
+* @param[in]    mode        - Blink mode (normal or smooth)
+* @param[in]    on_time     - Time that LED will be turned ON
+* @param[in]    period      - Period of blink
+* @param[in]    period_s    - Period of blink in seconds
+* @param[in]    blink       - Number of blinks
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_blink_start(led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode, const led_time_t on_time, const led_time_t period, const float32_t period_s, const led_blink_t blink)
+{
+    led_mode_set( p_ctx, num, mode );
+    p_ctx->p_led[num].on_time  = on_time;
+    p_ctx->p_led[num].period   = period;
+    p_ctx->p_led[num].per_time = 0;
+
+    #if ( 1 == LED_CFG_TIMESTAMP_EN )
+        led_ts_period_start( p_ctx, num, period_s );
+    #else
+        (void) period_s;
+        p_ctx->p_led[num].per_skip = eLED_PER_SKIP_ALL;
+    #endif
+
+    #if (( 1 == LED_CFG_FADE_LUT_EN ) && ( 1 == LED_PWM_USE_EN ))
+
+        // Start fading from current duty
+        if ( eLED_MODE_FADE_BLINK == mode )
+        {
+            led_fade_pos_seek( p_ctx, num );
+        }
+
+    #endif
+
+    #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+        // Rebuild waveform from current duty
+        p_ctx->p_led[num].dma_wave = eLED_DMA_WAVE_NONE;
+
+    #endif
+
+    if ( eLED_BLINK_CONTINUOUS == blink )
+    {
+        p_ctx->p_led[num].blink_cnt = LED_BLINK_CNT_CONT_VAL;
+    }
+    else
+    {
+        p_ctx->p_led[num].blink_cnt = (uint8_t) blink;
+    }
+}
+
+#if ( 1 == LED_PWM_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Start LED fading
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    state   - Final LED state
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_smooth_start(led_ctx_t * const p_ctx, const led_num_t num, const led_state_t state)
+    {
+        #if ( 1 == LED_CFG_FADE_LUT_EN )
+
+            // Start fading from current duty
+            led_fade_pos_seek( p_ctx, num );
+
+        #endif
+
+        #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+            // Rebuild waveform from current duty
+            p_ctx->p_led[num].dma_wave = eLED_DMA_WAVE_NONE;
+
+        #endif
+
+        if ( eLED_ON == state )
+        {
+            led_mode_set( p_ctx, num, eLED_MODE_FADE_IN );
+        }
+        else
+        {
+            led_mode_set( p_ctx, num, eLED_MODE_FADE_OUT );
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Fan out group duty to its members
+*
+* @note     When group state machine finishes, members are released to
+*           normal mode keeping final duty and report event of finished
+*           group mode.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - Group state machine number
+* @param[in]    mode    - Group mode at start of handler call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_group_fan_out(led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode)
+{
+    #if ( 1 == LED_CFG_GROUP_EN )
+
+        const uint8_t group = (uint8_t) ( num - eLED_NUM_OF );
+
+        for ( led_num_t member = 0; member < p_ctx->num_of; member++ )
+        {
+            if  (   ( eLED_MODE_GROUP == p_ctx->p_led[member].mode )
+                &&  ( group == p_ctx->p_led[member].group ))
+            {
+                p_ctx->p_led[member].duty = LED_DUTY_SCALE( p_ctx->p_led[num].duty, p_ctx->p_led[member].max_duty );
+
+                if ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode )
+                {
+                    led_mode_set( p_ctx, member, eLED_MODE_NORMAL );
+
+                    #if ( 1 == LED_CFG_EVENT_EN )
+
+                        // Released member - callback may already set new LED state
+                        led_event_hndl( p_ctx, member, mode );
+
+                    #endif
+                }
+            }
+        }
+
+        #if ( 0 == LED_CFG_EVENT_EN )
+            (void) mode;
+        #endif
+
+    #else
+        (void) p_ctx;
+        (void) num;
+        (void) mode;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle all group state machines
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    dt      - Elapsed time since last handler call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_group_hndl(led_ctx_t * const p_ctx, const led_time_t dt)
+{
+    #if ( 1 == LED_CFG_GROUP_EN )
+
+        for ( uint8_t group = 0; group < LED_GROUP_NUM_OF; group++ )
+        {
+            if ( eLED_MODE_NORMAL != p_ctx->p_led[ LED_GROUP_TO_NUM( group ) ].mode )
+            {
+                led_hndl_single( p_ctx, LED_GROUP_TO_NUM( group ), dt );
+            }
+        }
+
+    #else
+        (void) p_ctx;
+        (void) dt;
+    #endif
+}
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Post command to queue
+    *
+    * @brief    Multiple producers lock-free bounded queue. Slot is claimed
+    *           by atomic increment of write position and published by its
+    *           sequence, so commands are never torn.
+    *
+    * @note     Can be called from any context!
+    *
+    * @note     Commands address LEDs only, group state machines are never
+    *           driven by commands.
+    *
+    * @param[in]    p_cmd   - Pointer to command
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_status_t led_cmd_post(const led_cmd_t * const p_cmd)
+    {
+        led_status_t        status  = eLED_OK;
+        led_cmd_slot_t *    p_slot  = NULL;
+        uint32_t            pos     = g_cmd_wr;
+        uint32_t            last    = 0U;
+        int32_t             diff    = 0;
+
+        LED_ASSERT( p_cmd->num < eLED_NUM_OF );
+
+        // Claim slot
+        while ( NULL == p_slot )
+        {
+            diff = (int32_t) ( g_cmd_queue[ pos & LED_CMD_QUEUE_MASK ].seq - pos );
+
+            // Slot free
+            if ( 0 == diff )
+            {
+                if ( true == LED_CFG_CMD_CAS( &g_cmd_wr, pos, ( pos + 1U )))
+                {
+                    p_slot = &g_cmd_queue[ pos & LED_CMD_QUEUE_MASK ];
+                }
+            }
+
+            // Queue full
+            else if ( diff < 0 )
+            {
+                status = eLED_ERROR;
+                break;
+            }
+
+            // Other producer was faster
+            else
+            {
+                pos = g_cmd_wr;
+            }
+        }
+
+        if ( NULL != p_slot )
+        {
+            p_slot->cmd = *p_cmd;
+
+            // Set command supersedes older commands of same LED
+            if  (   ( eLED_CMD_SET == p_cmd->type )
+                ||  ( eLED_CMD_SET_SMOOTH == p_cmd->type ))
+            {
+                last = g_cmd_last[ p_cmd->num ];
+
+                while (( (int32_t) ( pos - last ) > 0 ) && ( false == LED_CFG_CMD_CAS( &g_cmd_last[ p_cmd->num ], last, pos )))
+                {
+                    // Retry with updated last...
+                }
+            }
+
+            // Publish command
+            LED_CFG_CMD_BARRIER();
+            p_slot->seq = ( pos + 1U );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Execute command
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    p_cmd   - Pointer to command
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_cmd_exec(led_ctx_t * const p_ctx, const led_cmd_t * const p_cmd)
+    {
+        const led_num_t num = (led_num_t) p_cmd->num;
+
+        switch( p_cmd->type )
+        {
+            case eLED_CMD_SET:
+                (void) led_ctx_set( p_ctx, num, (led_state_t) p_cmd->arg );
+                break;
+
+            case eLED_CMD_TOGGLE:
+                (void) led_ctx_toggle( p_ctx, num );
+                break;
+
+            case eLED_CMD_BLINK:
+                (void) led_ctx_blink( p_ctx, num, p_cmd->on_time, p_cmd->period, (led_blink_t) p_cmd->arg );
+                break;
+
+            #if ( 1 == LED_PWM_USE_EN )
+
+                case eLED_CMD_SET_SMOOTH:
+                    (void) led_ctx_set_smooth( p_ctx, num, (led_state_t) p_cmd->arg );
+                    break;
+
+                case eLED_CMD_BLINK_SMOOTH:
+                    (void) led_ctx_blink_smooth( p_ctx, num, p_cmd->on_time, p_cmd->period, (led_blink_t) p_cmd->arg );
+                    break;
+
+            #endif
+
+            default:
+                LED_ASSERT( 0 );
+                break;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Execute all posted commands
+    *
+    * @note     Commands superseded by newer set command of same LED are
+    *           skipped. Toggles are relative and always executed. Draining stops at slot that is claimed but not
+    *           yet published, it is handled on next handler call.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_cmd_hndl(led_ctx_t * const p_ctx)
+    {
+        led_cmd_slot_t * p_slot = &g_cmd_queue[ g_cmd_rd & LED_CMD_QUEUE_MASK ];
+
+        while ( p_slot->seq == ( g_cmd_rd + 1U ))
+        {
+            LED_CFG_CMD_BARRIER();
+
+            if  (   ( eLED_CMD_TOGGLE == p_slot->cmd.type )
+                ||  ( (int32_t) ( g_cmd_rd - g_cmd_last[ p_slot->cmd.num ] ) >= 0 ))
+            {
+                led_cmd_exec( p_ctx, &p_slot->cmd );
+            }
+
+            // Release slot
+            p_slot->seq = ( g_cmd_rd + LED_CFG_CMD_QUEUE_SIZE );
+            g_cmd_rd++;
+
+            p_slot = &g_cmd_queue[ g_cmd_rd & LED_CMD_QUEUE_MASK ];
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_SEQ_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       LED sequence FSM state
+    *
+    * @brief    Steps are executed directly from sequence table. Steps which
+    *           time elapsed are completed at once, so late handler calls
+    *           are caught up.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    dt      - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_seq_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+    {
+        const led_seq_step_t *  p_step      = NULL;
+        led_time_t              step_time   = 0;
+        led_duty_t              target      = 0;
+        uint8_t                 step_cnt    = 0U;
+        bool                    is_done     = false;
+
+        #if ( 1 == LED_CFG_TIMESTAMP_EN )
+            p_ctx->p_led[num].seq_time += dt;
+        #else
+            p_ctx->p_led[num].seq_time += led_skip_dt( p_ctx, num, dt );
+        #endif
+
+        while (( false == is_done ) && ( step_cnt < LED_SEQ_STEP_LIMIT ))
+        {
+            p_step = &p_ctx->p_led[num].p_seq[ p_ctx->p_led[num].seq_pc ];
+            step_cnt++;
+
+            switch( p_step->op )
+            {
+                case eLED_SEQ_OP_SET:
+                case eLED_SEQ_OP_LINEAR:
+                case eLED_SEQ_OP_SQUARE:
+
+                    step_time   = ((led_time_t) p_step->time * LED_TIME_TICK );
+                    target      = LED_DUTY_SCALE( LED_DUTY_FROM_U8( p_step->duty ), p_ctx->p_led[num].max_duty );
+
+                    // Step finished
+                    if (( p_ctx->p_led[num].seq_time + LED_TIME_EPS ) >= step_time )
+                    {
+                        p_ctx->p_led[num].seq_time -= step_time;
+                        p_ctx->p_led[num].duty      = target;
+                        p_ctx->p_led[num].seq_duty  = target;
+                        p_ctx->p_led[num].seq_pc++;
+                    }
+                    else
+                    {
+                        p_ctx->p_led[num].duty = led_seq_ramp( p_ctx, num, p_step, target );
+                        is_done = true;
+                    }
+                    break;
+
+                case eLED_SEQ_OP_JUMP:
+
+                    // Forever
+                    if ( 0U == p_step->duty )
+                    {
+                        p_ctx->p_led[num].seq_pc = p_step->time;
+                    }
+                    else
+                    {
+                        led_seq_loop( p_ctx, num, p_step );
+                    }
+                    break;
+
+                case eLED_SEQ_OP_END:
+                default:
+                    led_mode_set( p_ctx, num, eLED_MODE_NORMAL );
+                    p_ctx->p_led[num].seq_time = 0;
+                    is_done = true;
+                    break;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Execute counted sequence jump
+    *
+    * @brief    Counted loops are kept on small per LED stack. Loop is entered
+    *           on first arrival at its jump step and left after requested
+    *           number of repeats, so inner loop never uses counter of outer
+    *           loop.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    p_step  - Jump step
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_seq_loop(led_ctx_t * const p_ctx, const led_num_t num, const led_seq_step_t * const p_step)
+    {
+        const uint16_t  pc      = p_ctx->p_led[num].seq_pc;
+        uint8_t         depth   = p_ctx->p_led[num].seq_depth;
+
+        // Enter loop on first arrival
+        if  (   ( 0U == depth )
+            ||  ( pc != p_ctx->p_led[num].seq_loop_pc[ depth - 1U ] ))
+        {
+            LED_ASSERT( depth < LED_CFG_SEQ_LOOP_DEPTH );
+
+            if ( depth < LED_CFG_SEQ_LOOP_DEPTH )
+            {
+                p_ctx->p_led[num].seq_loop_pc[depth]   = pc;
+                p_ctx->p_led[num].seq_loop[depth]      = (uint8_t) ( p_step->duty + 1U );
+                depth++;
+                p_ctx->p_led[num].seq_depth            = depth;
+            }
+        }
+
+        if  (   ( depth > 0U )
+            &&  ( pc == p_ctx->p_led[num].seq_loop_pc[ depth - 1U ] ))
+        {
+            p_ctx->p_led[num].seq_loop[ depth - 1U ]--;
+
+            if ( p_ctx->p_led[num].seq_loop[ depth - 1U ] > 0U )
+            {
+                p_ctx->p_led[num].seq_pc = p_step->time;
+            }
+
+            // Loop done
+            else
+            {
+                p_ctx->p_led[num].seq_depth--;
+                p_ctx->p_led[num].seq_pc++;
+            }
+        }
+
+        // Nesting too deep - loop is skipped
+        else
+        {
+            p_ctx->p_led[num].seq_pc++;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate duty inside sequence ramp step
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    p_step  - Current step
+    * @param[in]    target  - Target duty of step
+    * @return       duty    - Current duty
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_duty_t led_seq_ramp(led_ctx_t * const p_ctx, const led_num_t num, const led_seq_step_t * const p_step, const led_duty_t target)
+    {
+        const led_duty_t    start   = p_ctx->p_led[num].seq_duty;
+        led_duty_t          duty    = target;
+
+        if ( eLED_SEQ_OP_SET != p_step->op )
+        {
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+                // Step progress in Q16
+                int64_t x = (int64_t) ((( uint64_t ) p_ctx->p_led[num].seq_time << 16U ) / p_step->time );
+
+                if ( eLED_SEQ_OP_SQUARE == p_step->op )
+                {
+                    x = (( x * x ) >> 16U );
+                }
+
+                duty = (led_duty_t) ( start + (((( int64_t ) target - start ) * x ) >> 16U ));
+
+            #else
+
+                // Step progress, step time can be just below zero by time tolerance
+                float32_t x = ( p_ctx->p_led[num].seq_time / ((float32_t) p_step->time * LED_TIME_TICK ));
+
+                x = (( x < 0.0f ) ? ( 0.0f ) : ( x ));
+
+                if ( eLED_SEQ_OP_SQUARE == p_step->op )
+                {
+                    x = ( x * x );
+                }
+
+                duty = ( start + (( target - start ) * x ));
+
+            #endif
+        }
+
+        return duty;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       LED ramp FSM state
+    *
+    * @brief    Duty is calculated from remaining ramp time and increment
+    *           precomputed on ramp start, so no division is done inside
+    *           handler.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    dt      - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_ramp_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_time_t dt)
+    {
+        if (( dt + LED_TIME_EPS ) < p_ctx->p_led[num].ramp_time )
+        {
+            p_ctx->p_led[num].ramp_time -= dt;
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                p_ctx->p_led[num].duty = (led_duty_t) ( p_ctx->p_led[num].ramp_target - ((( int64_t ) p_ctx->p_led[num].ramp_inc * p_ctx->p_led[num].ramp_time ) >> 15U ));
+            #else
+                p_ctx->p_led[num].duty = ( p_ctx->p_led[num].ramp_target - ( p_ctx->p_led[num].ramp_inc * p_ctx->p_led[num].ramp_time ));
+            #endif
+        }
+
+        // Target reached
+        else
+        {
+            p_ctx->p_led[num].ramp_time = 0;
+            p_ctx->p_led[num].duty      = p_ctx->p_led[num].ramp_target;
+
+            led_mode_set( p_ctx, num, eLED_MODE_NORMAL );
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Apply staged LED states
+    *
+    * @brief    All staged LEDs are set inside single handler call, thus
+    *           outputs never show partially applied state vector.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_bulk_hndl(led_ctx_t * const p_ctx)
+    {
+        if ( true == p_ctx->bulk_is_pending )
+        {
+            LED_CFG_CMD_BARRIER();
+
+            for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+            {
+                if ( 0U != ( p_ctx->bulk_mask[ num / 32U ] & ( 1UL << ( num % 32U ))))
+                {
+                    if ( 0U != ( p_ctx->bulk_state[ num / 32U ] & ( 1UL << ( num % 32U ))))
+                    {
+                        led_set_state( p_ctx, num, eLED_ON );
+                    }
+                    else
+                    {
+                        led_set_state( p_ctx, num, eLED_OFF );
+                    }
+                }
+            }
+
+            for ( uint32_t word = 0; word < LED_MASK_NUM_OF; word++ )
+            {
+                p_ctx->bulk_mask[word] = 0U;
+            }
+
+            p_ctx->bulk_is_pending = false;
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Report LED transition event
+    *
+    * @brief    Event is derived from mode which LED left and reported only
+    *           when subscribed by LED or globally.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    mode    - Mode that ended
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_event_hndl(led_ctx_t * const p_ctx, const led_num_t num, const led_mode_t mode)
+    {
+        uint8_t event = 0U;
+
+        switch( mode )
+        {
+            case eLED_MODE_FADE_IN:
+                event = eLED_EVENT_FADE_IN_DONE;
+                break;
+
+            case eLED_MODE_FADE_OUT:
+                event = eLED_EVENT_FADE_OUT_DONE;
+                break;
+
+            case eLED_MODE_BLINK:
+            case eLED_MODE_FADE_BLINK:
+                event = eLED_EVENT_BLINK_DONE;
+                break;
+
+            case eLED_MODE_SEQUENCE:
+                event = eLED_EVENT_SEQ_DONE;
+                break;
+
+            case eLED_MODE_RAMP:
+                event = eLED_EVENT_RAMP_DONE;
+                break;
+
+            case eLED_MODE_NORMAL:
+            case eLED_MODE_FADE_TOGGLE:
+            case eLED_MODE_GROUP:
+            default:
+                // No action...
+                break;
+        }
+
+        if ( 0U != ( event & ( p_ctx->event_mask | p_ctx->p_led[num].event_mask )))
+        {
+            LED_CFG_EVENT( p_ctx, num, (led_event_t) event );
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Advance trace clock
+    *
+    * @param[in]    dt  - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_trace_clock_hndl(const led_time_t dt)
+    {
+        #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+            g_trace_tick += (uint32_t) dt;
+
+        #else
+
+            uint32_t tick = 0U;
+
+            // Keep remainder, so trace clock does not drift
+            g_trace_rem += ( dt * LED_HNDL_FREQ_HZ );
+            tick = (uint32_t) ( g_trace_rem + 0.5f );
+            g_trace_rem -= (float32_t) tick;
+            g_trace_tick += tick;
+
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Record LED output into trace ring
+    *
+    * @brief    Entry consists of tick delta to previous recorded entry and
+    *           LED number, both as varint, followed by duty in Q16 format
+    *           (little endian). When ring is full entry is dropped and
+    *           number of lost entries is recorded before next entry that
+    *           fits into ring.
+    *
+    * @note     Only LEDs of configuration table are recorded. Group rows
+    *           have no low level driver and are never written out.
+    *
+    * @param[in]    num     - Number of LED
+    * @param[in]    duty    - Duty written to low level driver
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_trace_put(const led_num_t num, const led_duty_t duty)
+    {
+        uint8_t         entry[ 2U * LED_TRACE_ENTRY_SIZE ];
+        uint32_t        len     = 0U;
+        uint32_t        delta   = ( g_trace_tick - g_trace_last );
+        const uint16_t  value   = LED_TRACE_DUTY( duty );
+
+        LED_ASSERT( num < eLED_NUM_OF );
+
+        // Lost entries marker
+        if ( g_trace_lost > 0U )
+        {
+            len += led_trace_varint( &entry[len], delta );
+            len += led_trace_varint( &entry[len], LED_TRACE_NUM_LOST );
+            entry[len++] = (uint8_t) ( g_trace_lost & 0xFFU );
+            entry[len++] = (uint8_t) ( g_trace_lost >> 8U );
+            delta = 0U;
+        }
+
+        len += led_trace_varint( &entry[len], delta );
+        len += led_trace_varint( &entry[len], (uint32_t) num );
+        entry[len++] = (uint8_t) ( value & 0xFFU );
+        entry[len++] = (uint8_t) ( value >> 8U );
+
+        if ( len <= ( LED_CFG_TRACE_SIZE - ( g_trace_wr - g_trace_rd )))
+        {
+            for ( uint32_t idx = 0; idx < len; idx++ )
+            {
+                g_trace_buf[ ( g_trace_wr + idx ) & LED_TRACE_MASK ] = entry[idx];
+            }
+
+            // Publish entry
+            g_trace_wr += len;
+            g_trace_last = g_trace_tick;
+            g_trace_lost = 0U;
+        }
+        else
+        {
+            if ( g_trace_lost < 0xFFFFU )
+            {
+                g_trace_lost++;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Encode value as varint
+    *
+    * @note     Seven bits per byte, LSB first. MSB set on all but last byte.
+    *
+    * @param[out]   p_buf   - Output buffer, at least 5 bytes
+    * @param[in]    val     - Value to encode
+    * @return       len     - Number of encoded bytes
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t led_trace_varint(uint8_t * const p_buf, uint32_t val)
+    {
+        uint32_t len = 0U;
+
+        while ( val >= 0x80U )
+        {
+            p_buf[len++] = (uint8_t) (( val & 0x7FU ) | 0x80U );
+            val >>= 7U;
+        }
+
+        p_buf[len++] = (uint8_t) val;
+
+        return len;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get duty of value written to low level driver
+    *
+    * @brief    Driver value is normalized to duty, thus trace shows output
+    *           after brightness correction, global brightness, current limit
+    *           and polarity. On/off drivers are recorded as pin level.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - Number of LED
+    * @param[in]    out     - Value written to low level driver
+    * @return       duty    - Duty of driver value
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_duty_t led_trace_out_duty(led_ctx_t * const p_ctx, const led_num_t num, const led_duty_t out)
+    {
+        led_duty_t duty = out;
+
+        switch( p_ctx->p_cfg[num].drv_type )
+        {
+            #if ( 1 == LED_CFG_GPIO_USE_EN )
+                case eLED_DRV_GPIO:
+                    duty = ((led_duty_t) eGPIO_HIGH == out ) ? ( LED_DUTY_MAX ) : ( 0 );
+                    break;
+            #endif
+
+            case eLED_DRV_GPIO_PORT:
+            case eLED_DRV_FRAME:
+                duty = ( 0 != out ) ? ( LED_DUTY_MAX ) : ( 0 );
+                break;
+
+            #if ( 1 == LED_CFG_BCM_USE_EN )
+                case eLED_DRV_BCM:
+                    duty = LED_TRACE_OUT_DUTY( out, LED_BCM_LEVEL_MAX );
+                    break;
+            #endif
+
+            #if ( 1 == LED_CFG_ASYNC_USE_EN )
+                case eLED_DRV_ASYNC:
+                    duty = LED_TRACE_OUT_DUTY( out, LED_CFG_ASYNC_RES );
+                    break;
+            #endif
+
+            case eLED_DRV_TIMER_PWM:
+            case eLED_DRV_PIXEL:
+            default:
+                // Driver value is duty already
+                break;
+        }
+
+        return duty;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Put all group members under group control
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    group   - LED group
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_group_attach(led_ctx_t * const p_ctx, const led_group_t group)
+    {
+        for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+        {
+            if ( 0U != ( p_ctx->p_led[num].group_mask & ( 1UL << group )))
+            {
+                led_activate( p_ctx, num );
+                led_mode_set( p_ctx, num, eLED_MODE_GROUP );
+                p_ctx->p_led[num].group = (uint8_t) group;
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get elapsed time since last handler call
+    *
+    * @note     With fixed point engine timestamp remainder of handler period
+    *           is carried over to next call.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       dt      - Elapsed time since last handler call
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_time_t led_ts_elapsed(led_ctx_t * const p_ctx)
+    {
+        led_time_t      dt      = 0;
+        const uint32_t  dt_ts   = ( p_ctx->ts_now - p_ctx->ts_last );
+
+        #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+            const uint64_t num = (((uint64_t) dt_ts * LED_HNDL_FREQ_INT ) + p_ctx->ts_rem );
+
+            dt          = (led_time_t) ( num / LED_CFG_TIMESTAMP_FREQ_HZ );
+            p_ctx->ts_rem    = ( num % LED_CFG_TIMESTAMP_FREQ_HZ );
+
+        #else
+            dt = LED_TIME_FROM_TS( dt_ts );
+        #endif
+
+        p_ctx->ts_last = p_ctx->ts_now;
+
+        return dt;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Start blink period at current timestamp
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    period  - Period of blink
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_ts_period_start(led_ctx_t * const p_ctx, const led_num_t num, const float32_t period)
+    {
+        p_ctx->p_led[num].per_start = LED_CFG_TIMESTAMP_GET();
+        p_ctx->p_led[num].period_ts = LED_TS_FROM_S( period );
+
+        // Period shorter than timestamp resolution
+        if ( 0U == p_ctx->p_led[num].period_ts )
+        {
+            p_ctx->p_led[num].period_ts = 1U;
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Account handler execution cycles
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    cycles  - Handler execution cycles
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_stats_cycle_hndl(led_ctx_t * const p_ctx, const uint32_t cycles)
+    {
+        p_ctx->stats.hndl_cnt++;
+        p_ctx->stats_cycle_sum += cycles;
+
+        if ( cycles < p_ctx->stats.cycle_min )
+        {
+            p_ctx->stats.cycle_min = cycles;
+        }
+
+        if ( cycles > p_ctx->stats.cycle_max )
+        {
+            p_ctx->stats.cycle_max = cycles;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Put LED to active list
+*
+* @note     Shall be called on every LED mode or duty change! Staged bulk
+*           state of LED is dropped as well.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED number
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_activate(led_ctx_t * const p_ctx, const led_num_t num)
+{
+    #if ( 1 == LED_CFG_BULK_EN )
+
+        // Later API call supersedes staged state of LED
+        if ( num < p_ctx->num_of )
+        {
+            p_ctx->bulk_mask[ num / 32U ] &= ~( 1UL << ( num % 32U ));
+        }
+
+    #endif
+
+    #if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+        const uint32_t mask = ( 1UL << ( num & 0x1FU ));
+
+        if ( 0U == ( p_ctx->active[ num >> 5U ] & mask ))
+        {
+            // Catch up active time of idle period
+            led_active_time_fold( p_ctx, num );
+
+            p_ctx->active[ num >> 5U ] |= mask;
+        }
+
+    #else
+        (void) p_ctx;
+        (void) num;
+    #endif
+}
+
+#if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Evaluate active time of idle LED
+    *
+    * @brief    Idle LED keeps its duty, therefore time elapsed since last
+    *           evaluation is added at once.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_active_time_fold(led_ctx_t * const p_ctx, const led_num_t num)
+    {
+        if ( 0U == ( p_ctx->active[ num >> 5U ] & ( 1UL << ( num & 0x1FU ))))
+        {
+            led_manage_time( p_ctx, num, ( p_ctx->clock - p_ctx->p_led[num].idle_mark ));
+            p_ctx->p_led[num].idle_mark = p_ctx->clock;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Active list clock handler
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    dt      - Elapsed time since last handler call
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_clock_hndl(led_ctx_t * const p_ctx, const led_time_t dt)
+    {
+        p_ctx->clock += dt;
+
+        // Move clock back to zero
+        if ( p_ctx->clock >= LED_TIME_FROM_S( LED_CLOCK_REBASE_S ))
+        {
+            for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+            {
+                led_active_time_fold( p_ctx, num );
+                p_ctx->p_led[num].idle_mark = 0;
+            }
+
+            p_ctx->clock = 0;
+        }
+    }
+
+    #if !defined( __GNUC__ )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Count trailing zeros
+        *
+        * @param[in]    value   - Non zero value
+        * @return       cnt     - Number of trailing zero bits
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static uint32_t led_ctz(const uint32_t value)
+        {
+            uint32_t cnt = 0U;
+
+            while ( 0U == ( value & ( 1UL << cnt )))
+            {
+                cnt++;
+            }
+
+            return cnt;
+        }
+
+    #endif
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check configuration table
+*
+* @note     Polarity and driver channels are validated once here, so
+*           low level driver setters do not need to check them.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       status  - Status of configuration check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static led_status_t led_check_cfg(led_ctx_t * const p_ctx)
+{
+    led_status_t status = eLED_OK;
+
+    for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+    {
+        bool is_ch_ok = true;
+
+        switch( p_ctx->p_cfg[num].drv_type )
+        {
+            #if ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+                case eLED_DRV_GPIO_PORT:
+                    is_ch_ok = ( p_ctx->p_cfg[num].drv_ch.gpio_port.port < LED_CFG_GPIO_PORT_NUM_OF );
+                    break;
+            #endif
+
+            #if ( 1 == LED_CFG_FRAME_USE_EN )
+                case eLED_DRV_FRAME:
+                    is_ch_ok = ( p_ctx->p_cfg[num].drv_ch.frame_bit < ( LED_CFG_FRAME_SIZE * 8U ));
+                    break;
+            #endif
+
+            #if ( 1 == LED_CFG_PIXEL_USE_EN )
+                case eLED_DRV_PIXEL:
+                    is_ch_ok =  (   ( p_ctx->p_cfg[num].drv_ch.pixel.idx < LED_CFG_PIXEL_NUM_OF )
+                                &&  ( p_ctx->p_cfg[num].drv_ch.pixel.ch < LED_CFG_PIXEL_CH_NUM_OF ));
+                    break;
+            #endif
+
+            #if ( 1 == LED_CFG_BCM_USE_EN )
+                case eLED_DRV_BCM:
+                    is_ch_ok = ( p_ctx->p_cfg[num].drv_ch.bcm.port < LED_CFG_BCM_PORT_NUM_OF );
+                    break;
+            #endif
+
+            #if ( 1 == LED_CFG_ASYNC_USE_EN )
+                case eLED_DRV_ASYNC:
+                    is_ch_ok = ( p_ctx->p_cfg[num].drv_ch.async_ch < LED_CFG_ASYNC_CH_NUM_OF );
+                    break;
+            #endif
+
+            // Channel checked by low level driver
+            default:
+                // No action...
+                break;
+        }
+
+        if ( false == is_ch_ok )
+        {
+            LED_DBG_PRINT( "LED: Low level driver channel of LED out of range error!" );
+            status |= eLED_ERROR;
+        }
+
+        if  (   ( eLED_POL_ACTIVE_HIGH != p_ctx->p_cfg[num].polarity )
+            &&  ( eLED_POL_ACTIVE_LOW != p_ctx->p_cfg[num].polarity ))
+        {
+            LED_DBG_PRINT( "LED: Polarity of LED unknown error!" );
+            status |= eLED_ERROR;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check that low level drivers are initialized
+*
+* @note     Also checks that each LED uses enabled low level driver, so
+*           handler does not need to check driver type.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       status  - Status of low level initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static led_status_t led_check_drv_init(led_ctx_t * const p_ctx)
+{
+    led_status_t status = eLED_OK;
+
+    for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+    {
+        if ( !LED_DRV_IS_EN( p_ctx->p_cfg[num].drv_type ))
+        {
+            LED_DBG_PRINT( "LED: Low level driver of LED not enabled error!" );
+            status |= eLED_ERROR_INIT;
+        }
+
+        // Buffered low level drivers are used by default instance only
+        else if (( false == LED_CTX_IS_DEF( p_ctx )) && ( !LED_CTX_DRV_IS_OK( p_ctx->p_cfg[num].drv_type )))
+        {
+            LED_DBG_PRINT( "LED: Low level driver of LED not available to instance error!" );
+            status |= eLED_ERROR_INIT;
+        }
+        else
+        {
+            // No action...
+        }
+    }
+
+    #if ( 1 == LED_CTX_DEF_ONLY_EN )
+
+        // Groups, command queue, timer DMA waveforms, trace and phase slots are used by default instance only
+        if ( false == LED_CTX_IS_DEF( p_ctx ))
+        {
+            LED_DBG_PRINT( "LED: Options of default instance only enabled error!" );
+            status |= eLED_ERROR_INIT;
+        }
+
+    #endif
+
+    #if ( 1 == LED_CFG_TIMER_USE_EN )
+
+        bool tim_drv_init = false;
+
+        // Get init flag
+        timer_is_init( &tim_drv_init );
+
+        if ( false == tim_drv_init )
+        {
+            status |= eLED_ERROR_INIT;
+        }
+
+    #endif
+
+    #if ( 1 == LED_CFG_GPIO_USE_EN )
+
+        bool gpio_drv_init = false;
+
+        // Get init flag
+        gpio_is_init( &gpio_drv_init );
+
+        if ( false == gpio_drv_init )
+        {
+            status |= eLED_ERROR_INIT;
+        }
+
+    #endif
+
+    return status;
+}
+
+#if ( 1 == LED_CFG_GAMMA_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Build perceptual brightness correction table
+    *
+    * @brief    Table is based on CIE1931 lightness formula and quantized
+    *           to resolution of LED_CFG_GAMMA_LUT_RES.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_gamma_build(void)
+    {
+        float32_t lightness = 0.0f;
+        float32_t luminance = 0.0f;
+
+        for ( uint32_t idx = 0; idx < LED_CFG_GAMMA_LUT_SIZE; idx++ )
+        {
+            lightness = ( 100.0f * (float32_t) idx / (float32_t) ( LED_CFG_GAMMA_LUT_SIZE - 1 ));
+
+            if ( lightness <= 8.0f )
+            {
+                luminance = ( lightness / 903.3f );
+            }
+            else
+            {
+                luminance = (( lightness + 16.0f ) / 116.0f );
+                luminance = ( luminance * luminance * luminance );
+            }
+
+            // Quantize to output resolution
+            luminance = ((float32_t) (uint32_t) ( luminance * (float32_t) LED_CFG_GAMMA_LUT_RES + 0.5f ) / (float32_t) LED_CFG_GAMMA_LUT_RES );
+
+            g_gamma_lut[idx] = LED_DUTY_FROM_F( luminance );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Apply perceptual brightness correction
+    *
+    * @param[in]    duty    - Linear duty cycle
+    * @return       duty    - Corrected duty cycle
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_duty_t led_gamma_apply(const led_duty_t duty)
+    {
+        #if ( 1 == LED_CFG_FIXED_POINT_EN )
+            const uint32_t idx = ((( (uint32_t) duty * ( LED_CFG_GAMMA_LUT_SIZE - 1U )) + 0x8000U ) >> 16U );
+        #else
+            const uint32_t idx = (uint32_t) ( duty * (float32_t) ( LED_CFG_GAMMA_LUT_SIZE - 1 ) + 0.5f );
+        #endif
+
+        return g_gamma_lut[ ( idx < LED_CFG_GAMMA_LUT_SIZE ) ? ( idx ) : ( LED_CFG_GAMMA_LUT_SIZE - 1U ) ];
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if LED output needs to be written to low level driver
+*
+* @note     On change output cache is updated and dirty flag is cleared!
+*
+* @param[in]    p_ctx       - LED instance
+* @param[in]    led_num     - Number of LED
+* @param[in]    out         - Output of LED with applied polarity
+* @return       is_changed  - LED output changed or write is forced
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool led_is_out_changed(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t out)
+{
+    bool is_changed = false;
+
+    if  (   ( true == p_ctx->p_led[led_num].is_dirty )
+        ||  ( out != p_ctx->p_led[led_num].out ))
+    {
+        p_ctx->p_led[led_num].out      = out;
+        p_ctx->p_led[led_num].is_dirty = false;
+        is_changed = true;
+
+        #if ( 1 == LED_CFG_TRACE_EN )
+
+            // Record low level driver write, trace belongs to default instance
+            led_trace_put( led_num, led_trace_out_duty( p_ctx, led_num, out ));
+
+        #endif
+    }
+
+    return is_changed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Low level driver refresh handler
+*
+* @brief    Periodically force write of all LED outputs in order to recover
+*           from glitches on driver side.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    dt      - Elapsed time since last handler call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_refresh_hndl(led_ctx_t * const p_ctx, const led_time_t dt)
+{
+    #if ( 1 == LED_CFG_REFRESH_EN )
+
+        p_ctx->refresh_time += dt;
+
+        if ( p_ctx->refresh_time >= LED_TIME_FROM_S( LED_CFG_REFRESH_PERIOD_S ))
+        {
+            p_ctx->refresh_time = 0;
+
+            for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+            {
+                p_ctx->p_led[num].is_dirty = true;
+                led_activate( p_ctx, num );
+            }
+        }
+
+    #else
+        (void) p_ctx;
+        (void) dt;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Current budget limiter handler
+*
+* @brief    On change of estimated current or global brightness output scale
+*           of dimmable LEDs is re-evaluated. When it changes all dimmable
+*           LEDs are re-written in single pass and running timer DMA fading
+*           waveforms are re-built from current fading state.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_limit_hndl(led_ctx_t * const p_ctx)
+{
+    #if ( 1 == LED_CFG_LIMIT_EN )
+
+        led_duty_t scale = 0;
+
+        if ( true == p_ctx->limit_is_changed )
+        {
+            p_ctx->limit_is_changed = false;
+
+            scale = led_limit_scale_calc( p_ctx );
+
+            if ( scale != p_ctx->limit_scale )
+            {
+                p_ctx->limit_scale = scale;
+
+                for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+                {
+                    // Turned OFF LEDs are not affected by scale
+                    if  (   ( LED_DRV_IS_DIM( p_ctx->p_cfg[num].drv_type ))
+                        &&  ( p_ctx->p_led[num].out_duty > 0 ))
+                    {
+                        p_ctx->p_led[num].is_dirty = true;
+                        led_set_low( p_ctx, num, p_ctx->p_led[num].out_duty, p_ctx->p_led[num].max_duty );
+                    }
+
+                    #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+                        // Running fading waveform is re-built with new scale
+                        if ( true == LED_DMA_IS_ACTIVE( num ))
+                        {
+                            const led_dma_wave_t wave = (led_dma_wave_t) p_ctx->p_led[num].dma_wave;
+
+                            p_ctx->p_led[num].dma_wave = eLED_DMA_WAVE_NONE;
+                            led_dma_fade_hndl( p_ctx, num, wave );
+                        }
+
+                    #endif
+                }
+            }
+        }
+
+    #else
+        (void) p_ctx;
+    #endif
+}
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Update estimated current of LED
+    *
+    * @note     Sum of all estimated currents is updated incrementally, thus
+    *           only on change of LED duty.
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @param[in]    max_duty    - Maximum duty of LED
+    * @return       is_rise     - Estimated current of LED increased
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool led_limit_load_set(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t max_duty)
+    {
+        const uint32_t  old     = p_ctx->p_led[led_num].load;
+        uint32_t        load    = 0U;
+
+        if ( LED_DRV_IS_DIM( p_ctx->p_cfg[led_num].drv_type ))
+        {
+            #if ( 1 == LED_CFG_GAMMA_EN )
+                load = ( p_ctx->p_cfg[led_num].current_ma * (uint32_t) LED_DUTY_TO_U8( led_gamma_apply( duty )));
+            #else
+                load = ( p_ctx->p_cfg[led_num].current_ma * (uint32_t) LED_DUTY_TO_U8( duty ));
+            #endif
+
+            p_ctx->limit_load_dim = (( p_ctx->limit_load_dim - old ) + load );
+        }
+
+        // ON/OFF LED
+        else
+        {
+            if ( duty >= max_duty )
+            {
+                load = ( p_ctx->p_cfg[led_num].current_ma * 255UL );
+            }
+
+            p_ctx->limit_load_fix = (( p_ctx->limit_load_fix - old ) + load );
+        }
+
+        if ( load != old )
+        {
+            p_ctx->p_led[led_num].load = load;
+            p_ctx->limit_is_changed = true;
+        }
+
+        return ( load > old );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate output scale of dimmable LEDs
+    *
+    * @brief    Output scale equals global brightness as long as estimated
+    *           current fits into budget. Otherwise dimmable LEDs are scaled
+    *           down proportionally to current left by ON/OFF LEDs.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       scale   - Output scale of dimmable LEDs
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_duty_t led_limit_scale_calc(led_ctx_t * const p_ctx)
+    {
+        led_duty_t  scale       = p_ctx->brightness;
+        uint32_t    available   = 0U;
+
+        if ( LED_LIMIT_BUDGET > 0U )
+        {
+            if ( LED_LIMIT_BUDGET > p_ctx->limit_load_fix )
+            {
+                available = ( LED_LIMIT_BUDGET - p_ctx->limit_load_fix );
+            }
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+                if (( (uint64_t) p_ctx->limit_load_dim * p_ctx->brightness ) > ( (uint64_t) available * LED_DUTY_MAX ))
+                {
+                    scale = (led_duty_t) (( (uint64_t) available * LED_DUTY_MAX ) / p_ctx->limit_load_dim );
+                }
+
+            #else
+
+                if (( (float32_t) p_ctx->limit_load_dim * p_ctx->brightness ) > (float32_t) available )
+                {
+                    scale = ( (float32_t) available / (float32_t) p_ctx->limit_load_dim );
+                }
+
+            #endif
+        }
+
+        return scale;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_GPIO_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED via GPIO driver
+    *
+    *  @note    Based on duty cycle LED GPIO state is being determine!
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @param[in]    max_duty    - Maximum duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_gpio(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t max_duty)
+    {
+        // Apply polarity
+        const bool          is_high = (( duty >= max_duty ) != ( 0U != p_ctx->p_led[led_num].pol_xor ));
+        const gpio_state_t  state   = ( true == is_high ) ? ( eGPIO_HIGH ) : ( eGPIO_LOW );
+
+        // Set GPIO only on change
+        if ( true == led_is_out_changed( p_ctx, led_num, (led_duty_t) state ))
+        {
+            gpio_set( p_ctx->p_cfg[led_num].drv_ch.gpio_pin, state );
+            LED_STATS_INC( gpio_cnt );
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_TIMER_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set led via TIMER driver
+    *
+    *  @note    Duty is converted to timer driver format only here!
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_timer(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty)
+    {
+        bool is_slot = true;
+
+        #if ( 1 == LED_CFG_PHASE_EN )
+
+            // Write is deferred outside of LED phase slot
+            is_slot = led_phase_is_slot( p_ctx, led_num );
+
+        #endif
+
+        if ( true == is_slot )
+        {
+            const led_duty_t tim_duty = led_timer_duty_get( p_ctx, led_num, duty );
+
+            // Set timer PWM only on change and when not driven by DMA waveform
+            if  (   ( false == LED_DMA_IS_ACTIVE( led_num ))
+                &&  ( true == led_is_out_changed( p_ctx, led_num, tim_duty )))
+            {
+                timer_pwm_set( p_ctx->p_cfg[led_num].drv_ch.tim_ch, LED_DUTY_TO_F( tim_duty ));
+                LED_STATS_INC( timer_cnt );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get timer duty cycle of LED
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @return       tim_duty    - Duty with applied brightness correction and polarity
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static led_duty_t led_timer_duty_get(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty)
+    {
+        led_duty_t tim_duty = duty;
+
+        #if ( 1 == LED_CFG_GAMMA_EN )
+
+            // Apply brightness correction
+            tim_duty = led_gamma_apply( duty );
+
+        #endif
+
+        // Apply global brightness and current limit
+        tim_duty = LED_LIMIT_APPLY( tim_duty );
+
+        // Apply polarity
+        #if ( 1 == LED_CFG_FIXED_POINT_EN )
+            tim_duty = (led_duty_t) LED_POL_FOLD( tim_duty, LED_DUTY_MAX, p_ctx->p_led[led_num].pol_xor );
+        #else
+            tim_duty = ( (float32_t) p_ctx->p_led[led_num].pol_xor + (( 1.0f - ( 2.0f * (float32_t) p_ctx->p_led[led_num].pol_xor )) * tim_duty ));
+        #endif
+
+        return tim_duty;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_PHASE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Assign phase slots to timer PWM LEDs
+    *
+    * @brief    Slots are assigned round robin. Groups sharing any member are
+    *           merged, and all members of merged groups share slot of their
+    *           first member, so groups stay in lockstep. Each timer channel
+    *           phase offset is set according to its slot.
+    *
+    * @note     Re-assigned by handler after each change of group membership.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_phase_assign(led_ctx_t * const p_ctx)
+    {
+        uint8_t slot = 0U;
+
+        #if ( 1 == LED_CFG_GROUP_EN )
+            uint32_t    group_link[ eLED_GROUP_NUM_OF ];
+            uint8_t     group_slot[ eLED_GROUP_NUM_OF ];
+            bool        is_changed = true;
+
+            for ( uint32_t group = 0; group < (uint32_t) eLED_GROUP_NUM_OF; group++ )
+            {
+                group_link[group] = ( 1UL << group );
+                group_slot[group] = LED_PHASE_SLOT_ALL;
+            }
+
+            // Link groups of each timer PWM LED
+            for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+            {
+                if ( eLED_DRV_TIMER_PWM == p_ctx->p_cfg[num].drv_type )
+                {
+                    for ( uint32_t group = 0; group < (uint32_t) eLED_GROUP_NUM_OF; group++ )
+                    {
+                        if ( 0U != ( p_ctx->p_led[num].group_mask & ( 1UL << group )))
+                        {
+                            group_link[group] |= p_ctx->p_led[num].group_mask;
+                        }
+                    }
+                }
+            }
+
+            // Merge linked groups transitively
+            while ( true == is_changed )
+            {
+                is_changed = false;
+
+                for ( uint32_t group = 0; group < (uint32_t) eLED_GROUP_NUM_OF; group++ )
+                {
+                    for ( uint32_t link = 0; link < (uint32_t) eLED_GROUP_NUM_OF; link++ )
+                    {
+                        if  (   ( 0U != ( group_link[group] & ( 1UL << link )))
+                            &&  ( group_link[link] != ( group_link[link] | group_link[group] )))
+                        {
+                            group_link[link] |= group_link[group];
+                            is_changed = true;
+                        }
+                    }
+                }
+            }
+        #endif
+
+        for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+        {
+            if ( eLED_DRV_TIMER_PWM == p_ctx->p_cfg[num].drv_type )
+            {
+                p_ctx->p_led[num].phase_slot = slot;
+
+                #if ( 1 == LED_CFG_GROUP_EN )
+
+                    if ( 0U != p_ctx->p_led[num].group_mask )
+                    {
+                        uint32_t group  = 0U;
+                        uint32_t link   = 0U;
+
+                        while ( 0U == ( p_ctx->p_led[num].group_mask & ( 1UL << group )))
+                        {
+                            group++;
+                        }
+
+                        // Merged groups share slot of their lowest group
+                        while ( 0U == ( group_link[group] & ( 1UL << link )))
+                        {
+                            link++;
+                        }
+
+                        // First member takes slot for all merged groups
+                        if ( LED_PHASE_SLOT_ALL == group_slot[link] )
+                        {
+                            group_slot[link] = slot;
+                        }
+
+                        p_ctx->p_led[num].phase_slot = group_slot[link];
+                    }
+
+                #endif
+
+                // Next slot is taken only by LED with own slot
+                if ( slot == p_ctx->p_led[num].phase_slot )
+                {
+                    slot = (uint8_t) (( slot + 1U ) % LED_CFG_PHASE_SLOT_NUM_OF );
+                }
+
+                LED_CFG_PHASE_SET( p_ctx->p_cfg[num].drv_ch.tim_ch, ( (float32_t) p_ctx->p_led[num].phase_slot / (float32_t) LED_CFG_PHASE_SLOT_NUM_OF ));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if timer PWM LED can be written in current phase slot
+    *
+    * @note     Outside of its slot LED is marked as pending and written by
+    *           "led_phase_hndl()" in its slot, unless it is written directly
+    *           by handler in that slot. Only LEDs of configuration table
+    *           are marked, group rows have no low level driver.
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    num         - Number of LED
+    * @return       is_slot     - LED can be written
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool led_phase_is_slot(led_ctx_t * const p_ctx, const led_num_t num)
+    {
+        bool is_slot = true;
+
+        LED_ASSERT( num < eLED_NUM_OF );
+
+        if  (   ( LED_PHASE_SLOT_ALL == g_phase_slot )
+            ||  ( g_phase_slot == p_ctx->p_led[num].phase_slot ))
+        {
+            g_phase_pending[ num / 32U ] &= ~( 1UL << ( num % 32U ));
+        }
+        else
+        {
+            g_phase_pending[ num / 32U ] |= ( 1UL << ( num % 32U ));
+            is_slot = false;
+        }
+
+        return is_slot;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Phase slot handler
+    *
+    * @brief    Write deferred timer PWM LEDs of current phase slot, that
+    *           were not written by handler in this slot, with their latest
+    *           duty and advance to next phase slot.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_phase_hndl(led_ctx_t * const p_ctx)
+    {
+        for ( uint32_t word = 0; word < LED_PHASE_PENDING_NUM_OF; word++ )
+        {
+            for ( uint32_t bit = 0; ( bit < 32U ) && ( 0U != g_phase_pending[word] ); bit++ )
+            {
+                const led_num_t num = (led_num_t) (( word * 32U ) + bit );
+
+                if  (   ( 0U != ( g_phase_pending[word] & ( 1UL << bit )))
+                    &&  ( g_phase_slot == p_ctx->p_led[num].phase_slot ))
+                {
+                    g_phase_pending[word] &= ~( 1UL << bit );
+                    led_set_timer( p_ctx, num, p_ctx->p_led[num].out_duty );
+                }
+            }
+        }
+
+        g_phase_slot = (uint8_t) (( g_phase_slot + 1U ) % LED_CFG_PHASE_SLOT_NUM_OF );
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED via GPIO port driver
+    *
+    *  @note    LED pin is only collected into port masks. Actual port write
+    *           is done by "led_gpio_port_flush()" after all LEDs are handled!
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @param[in]    max_duty    - Maximum duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_gpio_port(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t max_duty)
+    {
+        const uint8_t   port    = p_ctx->p_cfg[led_num].drv_ch.gpio_port.port;
+        const uint32_t  mask    = p_ctx->p_cfg[led_num].drv_ch.gpio_port.mask;
+
+        // Apply polarity
+        const bool      is_high = (( duty >= max_duty ) != ( 0U != p_ctx->p_led[led_num].pol_xor ));
+
+        // Collect pin only on change, port is checked at init
+        if ( true == led_is_out_changed( p_ctx, led_num, (led_duty_t) is_high ))
+        {
+            if ( true == is_high )
+            {
+                g_gpio_port_set[port]   |= mask;
+                g_gpio_port_reset[port] &= ~mask;
+            }
+            else
+            {
+                g_gpio_port_reset[port] |= mask;
+                g_gpio_port_set[port]   &= ~mask;
+            }
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Write collected LED pins to GPIO ports
+*
+* @brief    Each port with changed LED pins is written with single masked
+*           port write, so all LEDs on a port change at the same time.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_gpio_port_flush(led_ctx_t * const p_ctx)
+{
+    #if ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+
+        for ( uint8_t port = 0; port < LED_CFG_GPIO_PORT_NUM_OF; port++ )
+        {
+            if (( g_gpio_port_set[port] | g_gpio_port_reset[port] ) != 0U )
+            {
+                LED_CFG_GPIO_PORT_WRITE( port, g_gpio_port_set[port], g_gpio_port_reset[port] );
+                LED_STATS_INC( gpio_port_cnt );
+
+                g_gpio_port_set[port]   = 0U;
+                g_gpio_port_reset[port] = 0U;
+            }
+        }
+
+    #else
+        (void) p_ctx;
+    #endif
+}
+
+#if ( 1 == LED_CFG_FRAME_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED via frame buffer driver
+    *
+    *  @note    LED bit is only updated inside frame. Frame transfer is started
+    *           by "led_frame_flush()" after all LEDs are handled!
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @param[in]    max_duty    - Maximum duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_frame(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t max_duty)
+    {
+        const uint16_t  bit     = p_ctx->p_cfg[led_num].drv_ch.frame_bit;
+        const uint8_t   mask    = (uint8_t) ( 1U << ( bit & 0x07U ));
+
+        // Apply polarity
+        const bool      is_high = (( duty >= max_duty ) != ( 0U != p_ctx->p_led[led_num].pol_xor ));
+
+        // Update frame only on change, bit is checked at init
+        if ( true == led_is_out_changed( p_ctx, led_num, (led_duty_t) is_high ))
+        {
+            if ( true == is_high )
+            {
+                g_frame[g_frame_wr][ bit >> 3U ] |= mask;
+            }
+            else
+            {
+                g_frame[g_frame_wr][ bit >> 3U ] &= (uint8_t) ~mask;
+            }
+
+            gb_frame_is_changed = true;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start frame transfer
+*
+* @brief    Changed frame is sent with single non-blocking transfer. When
+*           previous transfer is still in progress frame is sent on one of
+*           next handler calls, collecting all changes meanwhile.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_frame_flush(led_ctx_t * const p_ctx)
+{
+    #if ( 1 == LED_CFG_FRAME_USE_EN )
+
+        if  (   ( true == gb_frame_is_changed )
+            &&  ( false == gb_frame_tx_busy ))
+        {
+            const uint8_t tx_buf = g_frame_wr;
+
+            // Swap buffers and keep latest LED states in new one
+            g_frame_wr = (uint8_t) ( tx_buf ^ 1U );
+            memcpy( &g_frame[g_frame_wr][0], &g_frame[tx_buf][0], LED_CFG_FRAME_SIZE );
+
+            gb_frame_is_changed = false;
+            gb_frame_tx_busy    = true;
+
+            LED_CFG_FRAME_TX_START( &g_frame[tx_buf][0], LED_CFG_FRAME_SIZE );
+            LED_STATS_INC( tx_cnt );
+        }
+
+    #else
+        (void) p_ctx;
+    #endif
+}
+
+#if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED via pixel driver
+    *
+    *  @note    Only colour buffer is updated and pixel is marked as changed. It
+    *           is encoded into stream by "led_pixel_flush()". Polarity is not
+    *           applicable to pixels.
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_pixel(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty)
+    {
+        const uint16_t  idx     = p_ctx->p_cfg[led_num].drv_ch.pixel.idx;
+        const uint8_t   ch      = p_ctx->p_cfg[led_num].drv_ch.pixel.ch;
+        led_duty_t      px_duty = duty;
+
+        #if ( 1 == LED_CFG_GAMMA_EN )
+
+            // Apply brightness correction
+            px_duty = led_gamma_apply( duty );
+
+        #endif
+
+        // Apply global brightness and current limit
+        px_duty = LED_LIMIT_APPLY( px_duty );
+
+        // Pixel index and channel are checked at init
+        if ( true == led_is_out_changed( p_ctx, led_num, px_duty ))
+        {
+            const uint8_t value = LED_DUTY_TO_U8( px_duty );
+
+            if ( value != g_pixel[idx][ch] )
+            {
+                g_pixel[idx][ch] = value;
+                g_pixel_dirty[ idx >> 5U ] |= ( 1UL << ( idx & 0x1FU ));
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Encode pixel into DMA stream
+    *
+    * @note     Each data bit is encoded into single symbol, MSB first.
+    *
+    * @param[in]    idx     - Pixel index
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_pixel_encode(const uint16_t idx)
+    {
+        LED_CFG_PIXEL_SYM_TYPE * p_sym = &g_pixel_stream[ (uint32_t) idx * LED_CFG_PIXEL_CH_NUM_OF * 8U ];
+
+        for ( uint8_t ch = 0; ch < LED_CFG_PIXEL_CH_NUM_OF; ch++ )
+        {
+            for ( uint8_t mask = 0x80U; mask > 0U; mask >>= 1U )
+            {
+                *p_sym = ( g_pixel[idx][ch] & mask ) ? LED_CFG_PIXEL_SYM_1 : LED_CFG_PIXEL_SYM_0;
+                p_sym++;
+            }
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Encode changed pixels and start stream transfer
+*
+* @brief    Only changed pixels are re-encoded. Stream is not touched while
+*           previous transfer is in progress, changes are collected and
+*           encoded on one of next handler calls.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_pixel_flush(led_ctx_t * const p_ctx)
+{
+    #if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+        bool is_changed = false;
+
+        if ( false == gb_pixel_tx_busy )
+        {
+            for ( uint16_t word = 0; word < LED_PIXEL_DIRTY_NUM_OF; word++ )
+            {
+                uint32_t    dirty   = g_pixel_dirty[word];
+                uint16_t    idx     = (uint16_t) ( word * 32U );
+
+                // Skip unchanged pixels
+                if ( 0U != dirty )
+                {
+                    g_pixel_dirty[word] = 0U;
+                    is_changed          = true;
+
+                    for ( ; 0U != dirty; dirty >>= 1U, idx++ )
+                    {
+                        if ( dirty & 1U )
+                        {
+                            led_pixel_encode( idx );
+                        }
+                    }
+                }
+            }
+
+            if ( true == is_changed )
+            {
+                gb_pixel_tx_busy = true;
+
+                LED_CFG_PIXEL_TX_START( &g_pixel_stream[0], LED_PIXEL_STREAM_SIZE );
+                LED_STATS_INC( tx_cnt );
+            }
+        }
+
+    #else
+        (void) p_ctx;
+    #endif
+}
+
+#if ( 1 == LED_CFG_BCM_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED via BCM driver
+    *
+    *  @note    Only BCM level of LED is updated. Schedule is rebuilt by
+    *           "led_bcm_flush()" after all LEDs are handled!
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_bcm(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty)
+    {
+        led_duty_t  bcm_duty    = duty;
+        uint32_t    level       = 0U;
+
+        #if ( 1 == LED_CFG_GAMMA_EN )
+
+            // Apply brightness correction
+            bcm_duty = led_gamma_apply( duty );
+
+        #endif
+
+        // Apply global brightness and current limit
+        bcm_duty = LED_LIMIT_APPLY( bcm_duty );
+
+        level = LED_BCM_LEVEL( bcm_duty );
+        level = ( level > LED_BCM_LEVEL_MAX ) ? ( LED_BCM_LEVEL_MAX ) : ( level );
+
+        // Rebuild schedule only on change
+        if ( true == led_is_out_changed( p_ctx, led_num, (led_duty_t) level ))
+        {
+            gb_bcm_is_changed = true;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Rebuild BCM schedule
+*
+* @brief    Each bit of LED BCM level selects whether LED pin is active
+*           during that bit-plane. Schedule is built into buffer not used
+*           by interrupt and taken over at start of next BCM cycle.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_bcm_flush(led_ctx_t * const p_ctx)
+{
+    #if ( 1 == LED_CFG_BCM_USE_EN )
+
+        uint8_t     wr      = 0U;
+        uint32_t    level   = 0U;
+
+        if ( true == gb_bcm_is_changed )
+        {
+            gb_bcm_is_changed = false;
+
+            // Prevent interrupt taking over schedule being built
+            gb_bcm_is_ready = false;
+            wr = (uint8_t) ( g_bcm_rd ^ 1U );
+
+            for ( uint8_t bit = 0; bit < LED_CFG_BCM_BIT_NUM_OF; bit++ )
+            {
+                for ( uint8_t port = 0; port < LED_CFG_BCM_PORT_NUM_OF; port++ )
+                {
+                    g_bcm_plane[wr][bit][port] = 0U;
+                }
+            }
+
+            for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+            {
+                if ( eLED_DRV_BCM == p_ctx->p_cfg[num].drv_type )
+                {
+                    // Apply polarity
+                    level = ( (uint32_t) p_ctx->p_led[num].out ^ ( LED_BCM_LEVEL_MAX * p_ctx->p_led[num].pol_xor ));
+
+                    for ( uint8_t bit = 0; bit < LED_CFG_BCM_BIT_NUM_OF; bit++ )
+                    {
+                        if ( level & ( 1UL << bit ))
+                        {
+                            g_bcm_plane[wr][bit][ p_ctx->p_cfg[num].drv_ch.bcm.port ] |= p_ctx->p_cfg[num].drv_ch.bcm.mask;
+                        }
+                    }
+                }
+            }
+
+            gb_bcm_is_ready = true;
+        }
+
+    #else
+        (void) p_ctx;
+    #endif
+}
+
+#if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED via asynchronous driver
+    *
+    *  @note    Channel value is only stored and marked as changed. It is
+    *           submitted to driver by "led_async_flush()".
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    led_num     - Number of LED
+    * @param[in]    duty        - Current duty of LED
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void led_set_async(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty)
+    {
+        const uint16_t  ch          = p_ctx->p_cfg[led_num].drv_ch.async_ch;
+        led_duty_t      async_duty  = duty;
+        uint16_t        value       = 0U;
+
+        #if ( 1 == LED_CFG_GAMMA_EN )
+
+            // Apply brightness correction
+            async_duty = led_gamma_apply( duty );
+
+        #endif
+
+        // Apply global brightness and current limit
+        async_duty = LED_LIMIT_APPLY( async_duty );
+
+        value = LED_ASYNC_VALUE( async_duty );
+        value = ( value > LED_CFG_ASYNC_RES ) ? ( LED_CFG_ASYNC_RES ) : ( value );
+
+        // Apply polarity
+        value = (uint16_t) LED_POL_FOLD( value, LED_CFG_ASYNC_RES, p_ctx->p_led[led_num].pol_xor );
+
+        // Channel is checked at init
+        if ( true == led_is_out_changed( p_ctx, led_num, (led_duty_t) value ))
+        {
+            g_async_val[ch] = value;
+            g_async_dirty[ ch >> 5U ] |= ( 1UL << ( ch & 0x1FU ));
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Submit changed asynchronous driver channels
+*
+* @brief    All channels changed since last batch are submitted as single
+*           batch. While previous batch is in flight changes are kept and
+*           coalesced into next batch, so handler never waits for driver.
+*
+* @param[in]    p_ctx   - LED instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_async_flush(led_ctx_t * const p_ctx)
+{
+    #if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+        uint16_t num = 0U;
+
+        if ( false == gb_async_busy )
+        {
+            for ( uint16_t word = 0; word < LED_ASYNC_DIRTY_NUM_OF; word++ )
+            {
+                uint32_t    dirty   = g_async_dirty[word];
+                uint16_t    ch      = (uint16_t) ( word * 32U );
+
+                // Skip unchanged channels
+                if ( 0U != dirty )
+                {
+                    g_async_dirty[word] = 0U;
+
+                    for ( ; 0U != dirty; dirty >>= 1U, ch++ )
+                    {
+                        if ( dirty & 1U )
+                        {
+                            g_async_batch[num].ch       = ch;
+                            g_async_batch[num].value    = g_async_val[ch];
+                            num++;
+                        }
+                    }
+                }
+            }
+
+            if ( num > 0U )
+            {
+                gb_async_busy = true;
+
+                LED_CFG_ASYNC_SUBMIT( &g_async_batch[0], num );
+                LED_STATS_INC( tx_cnt );
+            }
+        }
+
+    #else
+        (void) p_ctx;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set LED via low level driver
+*
+* @note     Output stage is skipped when duty did not change since last pass!
+*
+* @param[in]    p_ctx       - LED instance
+* @param[in]    led_num     - Number of LED
+* @param[in]    duty        - Current duty of LED
+* @param[in]    max_duty    - Maximum duty of LED
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void led_set_low(led_ctx_t * const p_ctx, const led_num_t led_num, const led_duty_t duty, const led_duty_t max_duty)
+{
+    if  (   ( true == p_ctx->p_led[led_num].is_dirty )
+        ||  ( duty != p_ctx->p_led[led_num].out_duty ))
+    {
+        p_ctx->p_led[led_num].out_duty = duty;
+
+        #if ( 1 == LED_CFG_LIMIT_EN )
+
+            // Update estimated current, on rise output scale is re-evaluated
+            // before write, so budget is not exceeded until end of handler
+            if ( true == led_limit_load_set( p_ctx, led_num, duty, max_duty ))
+            {
+                led_limit_hndl( p_ctx );
+            }
+
+        #endif
+
+        // Single driver - no dispatch, driver type is checked at init
+        #if ( 1 == LED_DRV_NUM_OF_EN )
+
+            #if ( 1 == LED_CFG_TIMER_USE_EN )
+                led_set_timer( p_ctx, led_num, duty );
+                (void) max_duty;
+            #elif ( 1 == LED_CFG_GPIO_USE_EN )
+                led_set_gpio( p_ctx, led_num, duty, max_duty );
+            #elif ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+                led_set_gpio_port( p_ctx, led_num, duty, max_duty );
+            #elif ( 1 == LED_CFG_FRAME_USE_EN )
+                led_set_frame( p_ctx, led_num, duty, max_duty );
+            #elif ( 1 == LED_CFG_PIXEL_USE_EN )
+                led_set_pixel( p_ctx, led_num, duty );
+                (void) max_duty;
+            #elif ( 1 == LED_CFG_BCM_USE_EN )
+                led_set_bcm( p_ctx, led_num, duty );
+                (void) max_duty;
+            #else
+                led_set_async( p_ctx, led_num, duty );
+                (void) max_duty;
+            #endif
+
+        #else
+
+            switch( p_ctx->p_cfg[led_num].drv_type )
+            {
+                #if ( 1 == LED_CFG_TIMER_USE_EN )
+                    case eLED_DRV_TIMER_PWM:
+                        led_set_timer( p_ctx, led_num, duty );
+                        break;
+                #endif
+
+                #if ( 1 == LED_CFG_GPIO_USE_EN )
+                    case eLED_DRV_GPIO:
+                        led_set_gpio( p_ctx, led_num, duty, max_duty );
+                        break;
+                #endif
+
+                #if ( 1 == LED_CFG_GPIO_PORT_USE_EN )
+                    case eLED_DRV_GPIO_PORT:
+                        led_set_gpio_port( p_ctx, led_num, duty, max_duty );
+                        break;
+                #endif
+
+                #if ( 1 == LED_CFG_FRAME_USE_EN )
+                    case eLED_DRV_FRAME:
+                        led_set_frame( p_ctx, led_num, duty, max_duty );
+                        break;
+                #endif
+
+                #if ( 1 == LED_CFG_PIXEL_USE_EN )
+                    case eLED_DRV_PIXEL:
+                        led_set_pixel( p_ctx, led_num, duty );
+                        break;
+                #endif
+
+                #if ( 1 == LED_CFG_BCM_USE_EN )
+                    case eLED_DRV_BCM:
+                        led_set_bcm( p_ctx, led_num, duty );
+                        break;
+                #endif
+
+                #if ( 1 == LED_CFG_ASYNC_USE_EN )
+                    case eLED_DRV_ASYNC:
+                        led_set_async( p_ctx, led_num, duty );
+                        break;
+                #endif
+
+                // Unknown driver
+                default:
+                    LED_ASSERT( 0 );
+                    break;
+            }
+
+        #endif
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup LED_API
+* @{ <!-- BEGIN GROUP -->
+*
+*     Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize LED instance
+*
+* @pre     Timers/GPIO shall be initialized before calling that function!
+*
+* @note     Instance shall be zero initialized (e.g. static) before first
+*           initialization. Configuration table and state buffer are not
+*           copied, therefore they shall be kept valid while instance is
+*           in use.
+*
+* @note     Additional instances support GPIO and timer PWM low level
+*           drivers only and fail to initialize with "eLED_ERROR_INIT"
+*           when LED uses buffered low level driver or when groups,
+*           command queue or timer DMA waveforms are enabled.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    p_cfg   - Configuration table
+* @param[in]    p_led   - State buffer of "num_of" LEDs
+* @param[in]    num_of  - Number of LEDs
+* @return       status  - Status of initialisation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_init(led_ctx_t * const p_ctx, const led_cfg_t * const p_cfg, led_t * const p_led, const uint16_t num_of)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( NULL != p_ctx );
+
+    // Prevent multiple inits
+    if  (   ( NULL != p_ctx )
+        &&  ( false == p_ctx->is_init ))
+    {
+        // Set up instance
+        p_ctx->p_cfg    = p_cfg;
+        p_ctx->p_led    = p_led;
+        p_ctx->num_of   = num_of;
+
+        // Validate configuration table once
+        if  (   ( NULL != p_ctx->p_cfg )
+            &&  ( NULL != p_ctx->p_led )
+            &&  ( num_of <= LED_CFG_CTX_LED_NUM_OF )
+            &&  ( eLED_OK == led_check_cfg( p_ctx )))
+        {
+            // Check low level drivers
+            if ( eLED_OK == led_check_drv_init( p_ctx ))
+            {
+                // Set init success
+                p_ctx->is_init = true;
+
+                #if ( 1 == LED_CFG_GAMMA_EN )
+
+                    // Build brightness correction table shared by instances
+                    if ( false == gb_gamma_is_built )
+                    {
+                        led_gamma_build();
+                        gb_gamma_is_built = true;
+                    }
+
+                #endif
+
+                #if ( 1 == LED_CFG_STATS_EN )
+
+                    // Clear statistics
+                    led_ctx_reset_stats( p_ctx );
+
+                #endif
+
+                #if ( 1 == LED_CFG_REFRESH_EN )
+                    p_ctx->refresh_time = 0;
+                #endif
+
+                #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                    p_ctx->dt_rem = 0.0f;
+                #endif
+
+                #if ( 1 == LED_CFG_GROUP_EN )
+                    LED_ASSERT( eLED_GROUP_NUM_OF <= 32 );
+                #endif
+
+                #if ( 1 == LED_FADE_PROFILE_EN )
+
+                    // Release all fading profiles and build default one
+                    for ( uint8_t profile = 0; profile < LED_CFG_FADE_PROFILE_NUM_OF; profile++ )
+                    {
+                        p_ctx->fade_profile[profile].ref_cnt = 0;
+                    }
+
+                    led_fade_profile_build( p_ctx, LED_FADE_PROFILE_DEF, LED_DUTY_MAX, LED_TIME_FROM_S( LED_FADE_IN_TIME_S ), LED_TIME_FROM_S( LED_FADE_OUT_TIME_S ));
+
+                #endif
+
+                #if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+                    // All LEDs idle
+                    for ( uint32_t word = 0; word < LED_ACTIVE_NUM_OF; word++ )
+                    {
+                        p_ctx->active[word] = 0U;
+                    }
+
+                    p_ctx->clock = 0;
+
+                #endif
+
+                #if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+                    // Start time keeping
+                    p_ctx->ts_now    = LED_CFG_TIMESTAMP_GET();
+                    p_ctx->ts_last   = p_ctx->ts_now;
+
+                    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                        p_ctx->ts_rem = 0U;
+                    #endif
+
+                #endif
+
+                #if ( 1 == LED_CFG_EVENT_EN )
+
+                    // No subscribed events
+                    p_ctx->event_mask = 0U;
+
+                #endif
+
+                #if ( 1 == LED_CFG_BULK_EN )
+
+                    // Nothing staged
+                    for ( uint32_t word = 0; word < LED_MASK_NUM_OF; word++ )
+                    {
+                        p_ctx->bulk_mask[word]  = 0U;
+                        p_ctx->bulk_state[word] = 0U;
+                    }
+
+                    p_ctx->bulk_is_pending = false;
+
+                #endif
+
+                #if ( 1 == LED_CFG_LIMIT_EN )
+
+                    // Full brightness and no estimated current
+                    p_ctx->brightness       = LED_DUTY_MAX;
+                    p_ctx->limit_scale      = LED_DUTY_MAX;
+                    p_ctx->limit_load_dim   = 0U;
+                    p_ctx->limit_load_fix   = 0U;
+                    p_ctx->limit_is_changed = false;
+
+                #endif
+
+                // Reset peripherals of default instance
+                if ( true == LED_CTX_IS_DEF( p_ctx ))
+                {
+                    #if ( 1 == LED_CFG_CMD_QUEUE_EN )
+
+                        // Empty command queue
+                        for ( uint32_t pos = 0; pos < LED_CFG_CMD_QUEUE_SIZE; pos++ )
+                        {
+                            g_cmd_queue[pos].seq = pos;
+                        }
+
+                        for ( led_num_t num = 0; num < eLED_NUM_OF; num++ )
+                        {
+                            g_cmd_last[num] = 0U;
+                        }
+
+                        g_cmd_wr = 0U;
+                        g_cmd_rd = 0U;
+
+                    #endif
+
+                    #if ( 1 == LED_CFG_PHASE_EN )
+
+                        // Initial LED outputs are written at once
+                        g_phase_slot = LED_PHASE_SLOT_ALL;
+
+                        for ( uint32_t word = 0; word < LED_PHASE_PENDING_NUM_OF; word++ )
+                        {
+                            g_phase_pending[word] = 0U;
+                        }
+
+                        #if ( 1 == LED_CFG_GROUP_EN )
+                            g_phase_is_changed = false;
+                        #endif
+
+                    #endif
+
+                    #if ( 1 == LED_CFG_TRACE_EN )
+
+                        // Empty trace ring, initial LED outputs are recorded at tick 0
+                        g_trace_wr      = 0U;
+                        g_trace_rd      = 0U;
+                        g_trace_tick    = 0U;
+                        g_trace_last    = 0U;
+                        g_trace_lost    = 0U;
+
+                        #if ( 0 == LED_CFG_FIXED_POINT_EN )
+                            g_trace_rem = 0.0f;
+                        #endif
+
+                    #endif
+
+                    #if ( 1 == LED_CFG_TIMER_DMA_EN )
+
+                        // All waveform buffers free
+                        g_dma_used = 0U;
+
+                    #endif
+
+                    #if ( 1 == LED_CFG_BCM_USE_EN )
+
+                        // Collect BCM pins and stop at start of BCM cycle
+                        for ( led_num_t num = 0; num < eLED_NUM_OF; num++ )
+                        {
+                            if  (   ( eLED_DRV_BCM == p_ctx->p_cfg[num].drv_type )
+                                &&  ( p_ctx->p_cfg[num].drv_ch.bcm.port < LED_CFG_BCM_PORT_NUM_OF ))
+                            {
+                                g_bcm_port_mask[ p_ctx->p_cfg[num].drv_ch.bcm.port ] |= p_ctx->p_cfg[num].drv_ch.bcm.mask;
+                            }
+                        }
+
+                        g_bcm_bit       = 0U;
+                        gb_bcm_is_ready = false;
+
+                    #endif
+
+                    #if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+                        // No batch in flight
+                        gb_async_busy = false;
+
+                    #endif
+                }
+
+                // Set up live LED and group configuration
+                for ( led_num_t num = 0; num < LED_CTX_ROW_NUM_OF( p_ctx ); num++ )
+                {
+                    p_ctx->p_led[num].duty             = 0;
+                    p_ctx->p_led[num].max_duty         = LED_DUTY_MAX;
+                #if ( 1 == LED_PWM_USE_EN )
+                    #if ( 1 == LED_CFG_FADE_LUT_EN )
+                        p_ctx->p_led[num].fade_pos         = 0;
+                    #else
+                        p_ctx->p_led[num].fade_time        = 0;
+                    #endif
+                    #if ( 1 == LED_FADE_PROFILE_EN )
+                        p_ctx->p_led[num].fade_profile     = LED_FADE_PROFILE_DEF;
+                    #else
+                        p_ctx->p_led[num].fade_in_k        = led_calc_fade_k( LED_DUTY_MAX, LED_TIME_FROM_S( LED_FADE_IN_TIME_S ));
+                        p_ctx->p_led[num].fade_out_k       = led_calc_fade_k( LED_DUTY_MAX, LED_TIME_FROM_S( LED_FADE_OUT_TIME_S ));
+                        p_ctx->p_led[num].fade_out_time    = LED_TIME_FROM_S( LED_FADE_OUT_TIME_S );
+                    #endif
+                #endif
+                    p_ctx->p_led[num].period           = 0;
+                    p_ctx->p_led[num].per_time         = 0;
+                #if ( 0 == LED_CFG_TIMESTAMP_EN )
+                    p_ctx->p_led[num].per_skip         = eLED_PER_SKIP_NONE;
+                #endif
+                    p_ctx->p_led[num].on_time          = 0;
+                    p_ctx->p_led[num].active_time      = 0;
+                    p_ctx->p_led[num].out              = 0;
+                    p_ctx->p_led[num].out_duty         = 0;
+                    p_ctx->p_led[num].mode             = eLED_MODE_NORMAL;
+                    p_ctx->p_led[num].blink_cnt        = 0;
+                    p_ctx->p_led[num].is_dirty         = true;
+                    p_ctx->p_led[num].pol_xor          = 0U;
+                #if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+                    p_ctx->p_led[num].idle_mark        = 0;
+                #endif
+                #if ( 1 == LED_CFG_SEQ_EN )
+                    p_ctx->p_led[num].p_seq            = NULL;
+                    p_ctx->p_led[num].seq_time         = 0;
+                    p_ctx->p_led[num].seq_duty         = 0;
+                    p_ctx->p_led[num].seq_pc           = 0U;
+                    p_ctx->p_led[num].seq_depth        = 0U;
+                #endif
+                #if ( 1 == LED_CFG_GROUP_EN )
+                    p_ctx->p_led[num].group_mask       = 0U;
+                    p_ctx->p_led[num].group            = 0U;
+                #endif
+                #if ( 1 == LED_CFG_LIMIT_EN )
+                    p_ctx->p_led[num].load             = 0U;
+                #endif
+                #if ( 1 == LED_CFG_EVENT_EN )
+                    p_ctx->p_led[num].event_mask       = 0U;
+                #endif
+                #if ( 1 == LED_CFG_TIMER_DMA_EN )
+                    p_ctx->p_led[num].dma_wave         = eLED_DMA_WAVE_NONE;
+                    p_ctx->p_led[num].dma_buf          = LED_DMA_BUF_NONE;
+                #endif
+
+                    if ( num < p_ctx->num_of )
+                    {
+                        #if ( 1 == LED_CFG_GROUP_EN )
+                            p_ctx->p_led[num].group_mask = p_ctx->p_cfg[num].group_mask;
+                        #endif
+
+                        // Resolve polarity once
+                        p_ctx->p_led[num].pol_xor = (uint8_t) ( eLED_POL_ACTIVE_LOW == p_ctx->p_cfg[num].polarity );
+
+                        // Set LED initial value
+                        led_ctx_set( p_ctx, num, p_ctx->p_cfg[num].initial_state );
+                        led_set_low( p_ctx, num, p_ctx->p_led[num].duty, p_ctx->p_led[num].max_duty );
+                    }
+                }
+
+                // Scale dimmable LEDs to current budget
+                led_limit_hndl( p_ctx );
+
+                if ( true == LED_CTX_IS_DEF( p_ctx ))
+                {
+                    // Write GPIO ports
+                    led_gpio_port_flush( p_ctx );
+
+                    // Send frame
+                    led_frame_flush( p_ctx );
+
+                    #if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+                        // Encode all pixels
+                        for ( uint16_t idx = 0; idx < LED_CFG_PIXEL_NUM_OF; idx++ )
+                        {
+                            g_pixel_dirty[ idx >> 5U ] |= ( 1UL << ( idx & 0x1FU ));
+                        }
+
+                    #endif
+
+                    // Send pixels
+                    led_pixel_flush( p_ctx );
+
+                    // Build BCM schedule
+                    led_bcm_flush( p_ctx );
+
+                    // Submit asynchronous driver channels
+                    led_async_flush( p_ctx );
+
+                    #if ( 1 == LED_CFG_PHASE_EN )
+
+                        // Start staggering, first handler call writes slot 0
+                        led_phase_assign( p_ctx );
+                        g_phase_slot = 0U;
+
+                    #endif
+                }
+            }
+
+            // Low level drivers not initialised
+            else
+            {
+                LED_DBG_PRINT( "LED: Low level drivers not initialised error!" );
+                LED_ASSERT( 0 );
+                status = eLED_ERROR_INIT;
+            }
+        }
+        else
+        {
+            LED_DBG_PRINT( "LED: Config table invalid or state buffer unknown error!" );
+            LED_ASSERT( 0 );
+            status = eLED_ERROR_INIT;
+        }
+    }
+    else if ( NULL == p_ctx )
+    {
+        status = eLED_ERROR;
+    }
+    else
+    {
+        // No action...
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       De-Initialize LEDs
+*
+* @param[in]    p_ctx   - LED instance
+* @return       status  - Status of de-init
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_deinit(led_ctx_t * const p_ctx)
+{
+    led_status_t status = eLED_OK;
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        // Set all LEDs to initial state
+        for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+        {
+            led_ctx_set( p_ctx, num, p_ctx->p_cfg[num].initial_state );
+        }
+
+        // De-init success
+        p_ctx->is_init = false;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Get LED initialisation flag
+*
+* @param[in]    p_ctx       - LED instance
+* @param[out]   p_is_init   - Initialisation flag
+* @return       status      - Status of initialisation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_is_init(led_ctx_t * const p_ctx, bool * const p_is_init)
+{
+    led_status_t status = eLED_OK;
+
+    if  (   ( NULL != p_ctx )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = p_ctx->is_init;
+    }
+    else
+    {
+        status = eLED_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       LED handler
+*
+* @note     This function shall be called with constant period of value
+*           set in "led_cfg.h" with macro "LED_CFG_HNDL_PERIOD_S", unless
+*           timestamp time keeping is used. Then it may be called with
+*           rate reported by "led_get_hndl_rate()".
+*
+* @note     Low level driver is called only when LED output changes!
+*
+* @param[in]    p_ctx   - LED instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_hndl(led_ctx_t * const p_ctx)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        #if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+            // Elapsed time from timestamp
+            p_ctx->ts_now = LED_CFG_TIMESTAMP_GET();
+            led_hndl_time( p_ctx, led_ts_elapsed( p_ctx ));
+
+        #else
+            led_hndl_time( p_ctx, LED_TIME_TICK );
+        #endif
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       LED handler with variable elapsed time
+*
+* @brief    Moves all LED state machines forward by elapsed time since
+*           last handler call. Intended for tickless operation together
+*           with "led_get_next_deadline()".
+*
+* @note     Fading is still calculated with resolution of elapsed time,
+*           therefore during fading this function shall be called with
+*           period of "LED_CFG_HNDL_PERIOD_S".
+*
+* @note     With fixed point engine time is kept in handler periods, therefore
+*           elapsed time remainder is carried over to next call.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    dt      - Elapsed time since last handler call
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_hndl_elapsed(led_ctx_t * const p_ctx, const float32_t dt)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( dt >= 0.0f );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if ( dt >= 0.0f )
+        {
+            #if ( 1 == LED_CFG_TIMESTAMP_EN )
+
+                // Blink phase is still taken from timestamp
+                p_ctx->ts_now    = LED_CFG_TIMESTAMP_GET();
+                p_ctx->ts_last   = p_ctx->ts_now;
+
+            #endif
+
+            #if ( 1 == LED_CFG_FIXED_POINT_EN )
+
+                const led_time_t ticks = LED_TIME_FROM_S( dt + p_ctx->dt_rem );
+
+                // Carry remainder of handler period
+                p_ctx->dt_rem = (( dt + p_ctx->dt_rem ) - LED_TIME_TO_S( ticks ));
+
+                led_hndl_time( p_ctx, ticks );
+
+            #else
+                led_hndl_time( p_ctx, dt );
+            #endif
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get time until next required LED handler call
+*
+* @brief    Time is calculated from current mode and timings of all LEDs.
+*           In case all LEDs are static "LED_DEADLINE_NONE_S" is returned,
+*           meaning that handler does not need to be called until LED
+*           API is used.
+*
+* @note     During fading and while driver output is deferred by transfer
+*           in progress returned time equals "LED_CFG_HNDL_PERIOD_S".
+*
+* @param[in]    p_ctx   - LED instance
+* @param[out]   p_time  - Time till next handler call
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_get_next_deadline(led_ctx_t * const p_ctx, float32_t * const p_time)
+{
+    led_status_t    status      = eLED_OK;
+    led_time_t      time        = LED_TIME_LIMIT;
+    led_time_t      led_time    = 0;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( NULL != p_time );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if ( NULL != p_time )
+        {
+            for ( led_num_t num = 0; num < LED_CTX_ROW_NUM_OF( p_ctx ); num++ )
+            {
+                led_time = led_get_deadline( p_ctx, num );
+
+                if ( led_time < time )
+                {
+                    time = led_time;
+                }
+            }
+
+            // Deferred driver output is sent on next handler call
+            if ( true == led_is_out_deferred( p_ctx ))
+            {
+                time = LED_TIME_TICK;
+            }
+
+            #if ( 1 == LED_CFG_REFRESH_EN )
+
+                // Driver refresh deadline
+                if (( LED_TIME_FROM_S( LED_CFG_REFRESH_PERIOD_S ) - p_ctx->refresh_time ) < time )
+                {
+                    time = ( LED_TIME_FROM_S( LED_CFG_REFRESH_PERIOD_S ) - p_ctx->refresh_time );
+                }
+
+            #endif
+
+            // All LEDs static
+            if ( time >= LED_TIME_LIMIT )
+            {
+                *p_time = LED_DEADLINE_NONE_S;
+            }
+            else
+            {
+                *p_time = LED_TIME_TO_S( time );
+            }
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get currently required LED handler rate
+*
+* @brief    Rate equals "LED_CFG_HNDL_PERIOD_S" frequency while any LED is
+*           fading or running sequence, "LED_CFG_HNDL_SLOW_PERIOD_S" frequency
+*           while only blinking LEDs with ON and OFF times of multiple of slow
+*           period are active and zero when all LEDs are static and no driver
+*           output is deferred.
+*
+* @note     Handler shall be called with "led_hndl_elapsed()" with real
+*           elapsed time, or with "led_hndl()" when timestamp time keeping
+*           is used. Rate shall be re-evaluated after each handler call
+*           and LED API call.
+*
+* @param[in]    p_ctx   - LED instance
+* @param[out]   p_rate  - Required handler rate in Hz
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_get_hndl_rate(led_ctx_t * const p_ctx, float32_t * const p_rate)
+{
+    led_status_t    status      = eLED_OK;
+    float32_t       rate        = 0.0f;
+    float32_t       led_rate    = 0.0f;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( NULL != p_rate );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if ( NULL != p_rate )
+        {
+            for ( led_num_t num = 0; num < LED_CTX_ROW_NUM_OF( p_ctx ); num++ )
+            {
+                led_rate = led_get_rate( p_ctx, num );
+
+                if ( led_rate > rate )
+                {
+                    rate = led_rate;
+                }
+            }
+
+            // Deferred driver output is sent on next handler call
+            if ( true == led_is_out_deferred( p_ctx ))
+            {
+                rate = LED_HNDL_FREQ_HZ;
+            }
+
+            #if ( 1 == LED_CFG_REFRESH_EN )
+
+                // Driver refresh rate
+                if (( 1.0f / LED_CFG_REFRESH_PERIOD_S ) > rate )
+                {
+                    rate = ( 1.0f / LED_CFG_REFRESH_PERIOD_S );
+                }
+
+            #endif
+
+            *p_rate = rate;
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set LED state
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED enumeration number
+* @param[in]    state   - State of LED
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_set(led_ctx_t * const p_ctx, const uint16_t num, const led_state_t state)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( num < p_ctx->num_of );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if ( num < p_ctx->num_of )
+        {
+            led_set_state( p_ctx, num, state );
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Toggle LED
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - LED enumeration number
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_toggle(led_ctx_t * const p_ctx, const uint16_t num)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( num < p_ctx->num_of );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if ( num < p_ctx->num_of )
+        {
+            led_activate( p_ctx, num );
+
+            led_mode_set( p_ctx, num, eLED_MODE_NORMAL );
+
+            if ( p_ctx->p_led[num].duty >= p_ctx->p_led[num].max_duty )
+            {
+                p_ctx->p_led[num].duty = 0;
+            }
+            else
+            {
+                p_ctx->p_led[num].duty = p_ctx->p_led[num].max_duty ;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Put LED into blink mode
+*
+* @param[in]    p_ctx   - LED instance
+* @param[in]    num     - Number of LED
+* @param[in]    on_time - Time that LED will be turned ON
+* @param[in]    period  - Period of blink
+* @param[in]    blink   - Number of blinks
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_blink(led_ctx_t * const p_ctx, const uint16_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+{
+    led_status_t status = eLED_OK;
+
+    const led_time_t on_time_t  = LED_TIME_FROM_S( on_time );
+    const led_time_t period_t   = LED_TIME_FROM_S( period );
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( num < p_ctx->num_of );
+    LED_ASSERT( on_time_t < period_t  );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if  (   ( num < p_ctx->num_of )
+            &&  ( on_time_t < period_t )
+            &&  ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode ))
+        {
+            led_activate( p_ctx, num );
+            led_blink_start( p_ctx, num, eLED_MODE_BLINK, on_time_t, period_t, period, blink );
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get LED active (ON) time
+*
+* @param[in]    p_ctx           - LED instance
+* @param[in]    num             - LED number
+* @param[out]   p_active_time   - Pointer to LED active time
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_get_active_time(led_ctx_t * const p_ctx, const uint16_t num, float32_t * const p_active_time)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( num < p_ctx->num_of );
+    LED_ASSERT( NULL != p_active_time );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if  (   ( num < p_ctx->num_of )
+            &&  ( NULL != p_active_time ))
+        {
+            #if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+                // Catch up active time of idle LED
+                led_active_time_fold( p_ctx, num );
+
+            #endif
+
+            *p_active_time = LED_TIME_TO_S( p_ctx->p_led[num].active_time );
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Is LED in idle state
+*
+* @brief    Get if LED is in idle state, meaning that it no longer blinks!
+*
+* @param[in]    p_ctx       - LED instance
+* @param[in]    num         - LED number
+* @param[out]   p_is_idle   - Is LED in idle state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_ctx_is_idle(led_ctx_t * const p_ctx, const uint16_t num, bool * const p_is_idle)
+{
+    led_status_t status = eLED_OK;
+
+    LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+    LED_ASSERT( num < p_ctx->num_of );
+    LED_ASSERT( NULL != p_is_idle );
+
+    if ( true == LED_CTX_IS_INIT( p_ctx ))
+    {
+        if  (   ( num < p_ctx->num_of )
+            &&  ( NULL != p_is_idle ))
+        {
+            if ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode )
+            {
+                *p_is_idle = true;
+            }
+            else
+            {
+                *p_is_idle = false;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR;
+        }
+    }
+    else
+    {
+        status = eLED_ERROR_INIT;
+    }
+
+    return status;
+}
+
+#if ( 1 == LED_CFG_SEQ_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Run LED sequence
+    *
+    * @note     Sequence is not copied, therefore it shall be kept valid
+    *           (e.g. constant in flash) until sequence ends. It shall be
+    *           terminated with "LED_SEQ_END()" or endless jump.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    p_seq   - Pointer to sequence
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_sequence(led_ctx_t * const p_ctx, const uint16_t num, const led_seq_step_t * const p_seq)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( num < p_ctx->num_of );
+        LED_ASSERT( NULL != p_seq );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if  (   ( num < p_ctx->num_of )
+                &&  ( NULL != p_seq ))
+            {
+                led_activate( p_ctx, num );
+                led_mode_set( p_ctx, num, eLED_MODE_SEQUENCE );
+
+                p_ctx->p_led[num].p_seq     = p_seq;
+                p_ctx->p_led[num].seq_time  = 0;
+                p_ctx->p_led[num].seq_duty  = p_ctx->p_led[num].duty;
+                p_ctx->p_led[num].seq_pc    = 0U;
+                p_ctx->p_led[num].seq_depth = 0U;
+
+                #if ( 0 == LED_CFG_TIMESTAMP_EN )
+                    p_ctx->p_led[num].per_skip = eLED_PER_SKIP_ALL;
+                #endif
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Ramp LED duty to target
+    *
+    * @brief    Duty moves linearly from current duty to target duty in given
+    *           time. Calling it during running ramp retargets ramp from
+    *           current duty without restart, thus it can be used for cross
+    *           fading between arbitrary duty levels.
+    *
+    * @note     Target duty is relative to maximum duty of LED.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    duty    - Target duty cycle, range: [0.0 - 1.0]
+    * @param[in]    time    - Ramp time
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_ramp_to(led_ctx_t * const p_ctx, const uint16_t num, const float32_t duty, const float32_t time)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( num < p_ctx->num_of );
+        LED_ASSERT(( duty >= 0.0f ) && ( duty <= 1.0f ));
+        LED_ASSERT( time >= 0.0f );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if  (   ( num < p_ctx->num_of )
+                &&  ( duty >= 0.0f )
+                &&  ( duty <= 1.0f )
+                &&  ( time >= 0.0f ))
+            {
+                const led_duty_t target     = LED_DUTY_SCALE( LED_DUTY_FROM_F( duty ), p_ctx->p_led[num].max_duty );
+                const led_time_t ramp_time  = LED_TIME_FROM_S( time );
+
+                led_activate( p_ctx, num );
+                led_mode_set( p_ctx, num, eLED_MODE_RAMP );
+
+                p_ctx->p_led[num].ramp_target   = target;
+                p_ctx->p_led[num].ramp_time     = ramp_time;
+                p_ctx->p_led[num].ramp_inc      = 0;
+
+                // Increment is calculated only once per ramp
+                if ( ramp_time > 0 )
+                {
+                    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+                        p_ctx->p_led[num].ramp_inc = (led_ramp_inc_t) (((( int64_t ) target - p_ctx->p_led[num].duty ) * 32768 ) / (int64_t) ramp_time );
+                    #else
+                        p_ctx->p_led[num].ramp_inc = (( target - p_ctx->p_led[num].duty ) / ramp_time );
+                    #endif
+                }
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set state of many LEDs by bitmap
+    *
+    * @brief    States are staged and applied all at once on next handler
+    *           call. LEDs staged by previous call and not yet applied keep
+    *           their staged state, unless overwritten by this call.
+    *
+    * @note     Staged state of LED is dropped by any later API call on that
+    *           LED. Commands are executed after staged states are applied.
+    *
+    * @note     Both bitmaps shall have "LED_MASK_NUM_OF" words.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    p_mask  - Bitmap of LEDs to set
+    * @param[in]    p_state - Bitmap of LED states, set bit for ON
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_mask(led_ctx_t * const p_ctx, const uint32_t * const p_mask, const uint32_t * const p_state)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( NULL != p_mask );
+        LED_ASSERT( NULL != p_state );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if  (   ( NULL != p_mask )
+                &&  ( NULL != p_state ))
+            {
+                // Handler shall not apply partially staged states
+                p_ctx->bulk_is_pending = false;
+                LED_CFG_CMD_BARRIER();
+
+                for ( uint32_t word = 0; word < LED_MASK_NUM_OF; word++ )
+                {
+                    p_ctx->bulk_state[word] = (( p_ctx->bulk_state[word] & ~p_mask[word] ) | ( p_state[word] & p_mask[word] ));
+                    p_ctx->bulk_mask[word] |= p_mask[word];
+                }
+
+                // Publish staged states
+                LED_CFG_CMD_BARRIER();
+                p_ctx->bulk_is_pending = true;
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set state of many consecutive LEDs
+    *
+    * @brief    States are staged and applied all at once on next handler
+    *           call, same as with "led_ctx_set_mask()".
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    first   - Number of first LED
+    * @param[in]    p_state - States of LEDs
+    * @param[in]    num_of  - Number of LEDs
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_many(led_ctx_t * const p_ctx, const uint16_t first, const led_state_t * const p_state, const uint16_t num_of)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( NULL != p_state );
+        LED_ASSERT(( (uint32_t) first + num_of ) <= p_ctx->num_of );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if  (   ( NULL != p_state )
+                &&  (( (uint32_t) first + num_of ) <= p_ctx->num_of ))
+            {
+                // Handler shall not apply partially staged states
+                p_ctx->bulk_is_pending = false;
+                LED_CFG_CMD_BARRIER();
+
+                for ( uint16_t i = 0; i < num_of; i++ )
+                {
+                    const uint16_t num = ( first + i );
+
+                    p_ctx->bulk_mask[ num / 32U ] |= ( 1UL << ( num % 32U ));
+
+                    if ( eLED_ON == p_state[i] )
+                    {
+                        p_ctx->bulk_state[ num / 32U ] |= ( 1UL << ( num % 32U ));
+                    }
+                    else
+                    {
+                        p_ctx->bulk_state[ num / 32U ] &= ~( 1UL << ( num % 32U ));
+                    }
+                }
+
+                // Publish staged states
+                LED_CFG_CMD_BARRIER();
+                p_ctx->bulk_is_pending = true;
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Take snapshot of all LEDs
+    *
+    * @note     Snapshot is taken in single pass, therefore it is consistent
+    *           when taken from same context as handler.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[out]   p_snap  - Snapshot of LEDs
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_snapshot(led_ctx_t * const p_ctx, led_snapshot_t * const p_snap)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( NULL != p_snap );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if ( NULL != p_snap )
+            {
+                for ( uint32_t word = 0; word < LED_MASK_NUM_OF; word++ )
+                {
+                    p_snap->on[word]    = 0U;
+                    p_snap->idle[word]  = 0U;
+                }
+
+                for ( led_num_t num = 0; num < p_ctx->num_of; num++ )
+                {
+                    if ( p_ctx->p_led[num].duty > 0 )
+                    {
+                        p_snap->on[ num / 32U ] |= ( 1UL << ( num % 32U ));
+                    }
+
+                    if ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode )
+                    {
+                        p_snap->idle[ num / 32U ] |= ( 1UL << ( num % 32U ));
+                    }
+                }
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED event subscription
+    *
+    * @note     Event is reported when subscribed by LED or globally.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED number
+    * @param[in]    mask    - Subscribed events, "led_event_t" bits
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_event_mask(led_ctx_t * const p_ctx, const uint16_t num, const uint8_t mask)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( num < p_ctx->num_of );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if ( num < p_ctx->num_of )
+            {
+                p_ctx->p_led[num].event_mask = ( mask & (uint8_t) eLED_EVENT_ALL );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set global event subscription
+    *
+    * @note     Applies to all LEDs of instance in addition to per LED
+    *           subscription.
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    mask    - Subscribed events, "led_event_t" bits
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_event_mask_global(led_ctx_t * const p_ctx, const uint8_t mask)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            p_ctx->event_mask = ( mask & (uint8_t) eLED_EVENT_ALL );
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Post set LED state command
+    *
+    * @note     Can be called from interrupt or other task. Command is
+    *           executed in next "led_hndl()" call.
+    *
+    * @param[in]    num     - LED number
+    * @param[in]    state   - State of LED
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_cmd_set(const led_num_t num, const led_state_t state)
+    {
+        led_status_t    status  = eLED_OK;
+        led_cmd_t       cmd     = { .type = eLED_CMD_SET, .num = (uint16_t) num, .arg = (uint8_t) state };
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( num < eLED_NUM_OF );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if ( num < eLED_NUM_OF )
+            {
+                status = led_cmd_post( &cmd );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Post toggle LED command
+    *
+    * @note     Can be called from interrupt or other task. Command is
+    *           executed in next "led_hndl()" call.
+    *
+    * @param[in]    num     - LED number
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_cmd_toggle(const led_num_t num)
+    {
+        led_status_t    status  = eLED_OK;
+        led_cmd_t       cmd     = { .type = eLED_CMD_TOGGLE, .num = (uint16_t) num };
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( num < eLED_NUM_OF );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if ( num < eLED_NUM_OF )
+            {
+                status = led_cmd_post( &cmd );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Post blink LED command
+    *
+    * @note     Can be called from interrupt or other task. Command is
+    *           executed in next "led_hndl()" call.
+    *
+    * @param[in]    num     - LED number
+    * @param[in]    on_time - Time of LED ON
+    * @param[in]    period  - Period of blink
+    * @param[in]    blink   - Number of blinks
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_cmd_blink(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+    {
+        led_status_t    status  = eLED_OK;
+        led_cmd_t       cmd     = { .type = eLED_CMD_BLINK, .num = (uint16_t) num, .arg = (uint8_t) blink, .on_time = on_time, .period = period };
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( num < eLED_NUM_OF );
+        LED_ASSERT( on_time < period );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if  (   ( num < eLED_NUM_OF )
+                &&  ( on_time < period ))
+            {
+                status = led_cmd_post( &cmd );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    #if ( 1 == LED_PWM_USE_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Post smooth set LED state command
+        *
+        * @note     Can be called from interrupt or other task. Command is
+        *           executed in next "led_hndl()" call.
+        *
+        * @param[in]    num     - LED number
+        * @param[in]    state   - State of LED
+        * @return       status  - Status of operation
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        led_status_t led_cmd_set_smooth(const led_num_t num, const led_state_t state)
+        {
+            led_status_t    status  = eLED_OK;
+            led_cmd_t       cmd     = { .type = eLED_CMD_SET_SMOOTH, .num = (uint16_t) num, .arg = (uint8_t) state };
+
+            LED_ASSERT( true == g_led_ctx.is_init );
+            LED_ASSERT( num < eLED_NUM_OF );
+
+            if ( true == g_led_ctx.is_init )
+            {
+                if ( num < eLED_NUM_OF )
+                {
+                    status = led_cmd_post( &cmd );
+                }
+                else
+                {
+                    status = eLED_ERROR;
+                }
+            }
+            else
+            {
+                status = eLED_ERROR_INIT;
+            }
+
+            return status;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Post smooth blink LED command
+        *
+        * @note     Can be called from interrupt or other task. Command is
+        *           executed in next "led_hndl()" call.
+        *
+        * @param[in]    num     - LED number
+        * @param[in]    on_time - Time of LED ON
+        * @param[in]    period  - Period of blink
+        * @param[in]    blink   - Number of blinks
+        * @return       status  - Status of operation
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        led_status_t led_cmd_blink_smooth(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+        {
+            led_status_t    status  = eLED_OK;
+            led_cmd_t       cmd     = { .type = eLED_CMD_BLINK_SMOOTH, .num = (uint16_t) num, .arg = (uint8_t) blink, .on_time = on_time, .period = period };
+
+            LED_ASSERT( true == g_led_ctx.is_init );
+            LED_ASSERT( num < eLED_NUM_OF );
+            LED_ASSERT( on_time < period );
+
+            if ( true == g_led_ctx.is_init )
+            {
+                if  (   ( num < eLED_NUM_OF )
+                    &&  ( on_time < period ))
+                {
+                    status = led_cmd_post( &cmd );
+                }
+                else
+                {
+                    status = eLED_ERROR;
+                }
+            }
+            else
+            {
+                status = eLED_ERROR_INIT;
+            }
+
+            return status;
+        }
+
+    #endif
+
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Drain LED output trace
+    *
+    * @note     Trace is binary byte stream and can be read in chunks of any
+    *           size, e.g. to be sent over UART or RTT. Shall be called from
+    *           single context, it may interrupt LED handler.
+    *
+    * @note     Trace is recorded for default instance only.
+    *
+    * @param[out]   p_buf   - Output buffer
+    * @param[in]    size    - Size of output buffer in bytes
+    * @param[out]   p_len   - Number of bytes read
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_trace_read(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+    {
+        led_status_t    status  = eLED_OK;
+        uint32_t        len     = 0U;
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( NULL != p_buf );
+        LED_ASSERT( NULL != p_len );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if  (   ( NULL != p_buf )
+                &&  ( NULL != p_len ))
+            {
+                const uint32_t rd = g_trace_rd;
+
+                len = ( g_trace_wr - rd );
+                len = ( len > size ) ? ( size ) : ( len );
+
+                for ( uint32_t idx = 0; idx < len; idx++ )
+                {
+                    p_buf[idx] = g_trace_buf[ ( rd + idx ) & LED_TRACE_MASK ];
+                }
+
+                // Release read bytes
+                g_trace_rd = ( rd + len );
+
+                *p_len = len;
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Add LED to group
+    *
+    * @param[in]    group   - LED group
+    * @param[in]    num     - LED number
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_group_add(const led_group_t group, const led_num_t num)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( group < eLED_GROUP_NUM_OF );
+        LED_ASSERT( num < eLED_NUM_OF );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if  (   ( group < eLED_GROUP_NUM_OF )
+                &&  ( num < eLED_NUM_OF ))
+            {
+                g_led_ctx.p_led[num].group_mask |= ( 1UL << group );
+
+                #if ( 1 == LED_CFG_PHASE_EN )
+
+                    // Keep group in lockstep, slots are re-assigned by handler
+                    LED_CFG_CMD_BARRIER();
+                    g_phase_is_changed = true;
+
+                #endif
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Remove LED from group
+    *
+    * @param[in]    group   - LED group
+    * @param[in]    num     - LED number
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_group_remove(const led_group_t group, const led_num_t num)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( group < eLED_GROUP_NUM_OF );
+        LED_ASSERT( num < eLED_NUM_OF );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if  (   ( group < eLED_GROUP_NUM_OF )
+                &&  ( num < eLED_NUM_OF ))
+            {
+                g_led_ctx.p_led[num].group_mask &= ~( 1UL << group );
+
+                // Release LED from group control
+                if  (   ( eLED_MODE_GROUP == g_led_ctx.p_led[num].mode )
+                    &&  ( (uint8_t) group == g_led_ctx.p_led[num].group ))
+                {
+                    led_mode_set( &g_led_ctx, num, eLED_MODE_NORMAL );
+                }
+
+                #if ( 1 == LED_CFG_PHASE_EN )
+
+                    // LED takes own slot, slots are re-assigned by handler
+                    LED_CFG_CMD_BARRIER();
+                    g_phase_is_changed = true;
+
+                #endif
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set state of all group members
+    *
+    * @param[in]    group   - LED group
+    * @param[in]    state   - State of LEDs
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_group_set(const led_group_t group, const led_state_t state)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( group < eLED_GROUP_NUM_OF );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if ( group < eLED_GROUP_NUM_OF )
+            {
+                // Stop group state machine
+                led_mode_set( &g_led_ctx, LED_GROUP_TO_NUM( group ), eLED_MODE_NORMAL );
+
+                for ( led_num_t num = 0; num < eLED_NUM_OF; num++ )
+                {
+                    if ( 0U != ( g_led_ctx.p_led[num].group_mask & ( 1UL << group )))
+                    {
+                        led_set( num, state );
+                    }
+                }
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Blink all group members
+    *
+    * @note     All group members are driven by single state machine, so
+    *           they stay in phase. Members leave group control on any
+    *           single LED API call or when blinking finishes.
+    *
+    * @param[in]    group   - LED group
+    * @param[in]    on_time - Time that LEDs will be turned ON
+    * @param[in]    period  - Period of blink
+    * @param[in]    blink   - Number of blinks
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_group_blink(const led_group_t group, const float32_t on_time, const float32_t period, const led_blink_t blink)
+    {
+        led_status_t status = eLED_OK;
+
+        const led_time_t on_time_t  = LED_TIME_FROM_S( on_time );
+        const led_time_t period_t   = LED_TIME_FROM_S( period );
+
+        LED_ASSERT( true == g_led_ctx.is_init );
+        LED_ASSERT( group < eLED_GROUP_NUM_OF );
+        LED_ASSERT( on_time_t < period_t );
+
+        if ( true == g_led_ctx.is_init )
+        {
+            if  (   ( group < eLED_GROUP_NUM_OF )
+                &&  ( on_time_t < period_t ))
+            {
+                led_blink_start( &g_led_ctx, LED_GROUP_TO_NUM( group ), eLED_MODE_BLINK, on_time_t, period_t, period, blink );
+                led_group_attach( &g_led_ctx, group );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    #if ( 1 == LED_PWM_USE_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Set all group members smoothly (fade in/out)
+        *
+        * @param[in]    group   - LED group
+        * @param[in]    state   - Final state of LEDs
+        * @return       status  - Status of operation
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        led_status_t led_group_set_smooth(const led_group_t group, const led_state_t state)
+        {
+            led_status_t status = eLED_OK;
+
+            LED_ASSERT( true == g_led_ctx.is_init );
+            LED_ASSERT( group < eLED_GROUP_NUM_OF );
+
+            if ( true == g_led_ctx.is_init )
+            {
+                if ( group < eLED_GROUP_NUM_OF )
+                {
+                    led_smooth_start( &g_led_ctx, LED_GROUP_TO_NUM( group ), state );
+                    led_group_attach( &g_led_ctx, group );
+                }
+                else
+                {
+                    status = eLED_ERROR;
+                }
+            }
+            else
+            {
+                status = eLED_ERROR_INIT;
+            }
+
+            return status;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Smooth blink all group members (fade in/out)
+        *
+        * @note     All group members are driven by single state machine, so
+        *           they stay in phase. Members leave group control on any
+        *           single LED API call or when blinking finishes.
+        *
+        * @param[in]    group   - LED group
+        * @param[in]    on_time - Time that LEDs will be turned ON
+        * @param[in]    period  - Period of blink
+        * @param[in]    blink   - Number of blinks
+        * @return       status  - Status of operation
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        led_status_t led_group_blink_smooth(const led_group_t group, const float32_t on_time, const float32_t period, const led_blink_t blink)
+        {
+            led_status_t status = eLED_OK;
+
+            const led_time_t on_time_t  = LED_TIME_FROM_S( on_time );
+            const led_time_t period_t   = LED_TIME_FROM_S( period );
+
+            LED_ASSERT( true == g_led_ctx.is_init );
+            LED_ASSERT( group < eLED_GROUP_NUM_OF );
+            LED_ASSERT( on_time_t < period_t );
+
+            if ( true == g_led_ctx.is_init )
+            {
+                if  (   ( group < eLED_GROUP_NUM_OF )
+                    &&  ( on_time_t < period_t ))
+                {
+                    led_blink_start( &g_led_ctx, LED_GROUP_TO_NUM( group ), eLED_MODE_FADE_BLINK, on_time_t, period_t, period, blink );
+                    led_group_attach( &g_led_ctx, group );
+                }
+                else
+                {
+                    status = eLED_ERROR;
+                }
+            }
+            else
+            {
+                status = eLED_ERROR_INIT;
+            }
+
+            return status;
+        }
+
+    #endif
+
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set global brightness
+    *
+    * @note     Scales outputs of all dimmable LEDs on next handler call.
+    *           ON/OFF LEDs are not affected.
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    brightness  - Global brightness in range of [0.0 - 1.0]
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_brightness(led_ctx_t * const p_ctx, const float32_t brightness)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT(( brightness >= 0.0f ) && ( brightness <= 1.0f ));
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if (( brightness >= 0.0f ) && ( brightness <= 1.0f ))
+            {
+                p_ctx->brightness = LED_DUTY_FROM_F( brightness );
+                p_ctx->limit_is_changed = true;
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get global brightness
+    *
+    * @param[in]    p_ctx           - LED instance
+    * @param[out]   p_brightness    - Global brightness
+    * @return       status          - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_get_brightness(led_ctx_t * const p_ctx, float32_t * const p_brightness)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( NULL != p_brightness );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if ( NULL != p_brightness )
+            {
+                *p_brightness = LED_DUTY_TO_F( p_ctx->brightness );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get estimated LED current
+    *
+    * @note     Current is estimated from "current_ma" of LED configuration
+    *           and output duty after global brightness and current limit.
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[out]   p_current   - Estimated current of all LEDs in mA
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_get_current(led_ctx_t * const p_ctx, float32_t * const p_current)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( NULL != p_current );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if ( NULL != p_current )
+            {
+                *p_current = ((float32_t) p_ctx->limit_load_fix + (float32_t) p_ctx->limit_load_dim * LED_DUTY_TO_F( p_ctx->limit_scale )) * ( 1.0f / 255.0f );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get LED handler statistics
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[out]   p_stats - Pointer to statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_get_stats(led_ctx_t * const p_ctx, led_stats_t * const p_stats)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( NULL != p_stats );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if ( NULL != p_stats )
+            {
+                *p_stats = p_ctx->stats;
+
+                if ( p_ctx->stats.hndl_cnt > 0U )
+                {
+                    p_stats->cycle_avg = (uint32_t) ( p_ctx->stats_cycle_sum / p_ctx->stats.hndl_cnt );
+                }
+                else
+                {
+                    p_stats->cycle_min = 0U;
+                }
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset LED handler statistics
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_reset_stats(led_ctx_t * const p_ctx)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            p_ctx->stats = (led_stats_t) { 0 };
+            p_ctx->stats.cycle_min = UINT32_MAX;
+            p_ctx->stats_cycle_sum = 0U;
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_FRAME_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Frame transfer completed
+    *
+    * @note     Shall be called by user on completion of transfer started by
+    *           "LED_CFG_FRAME_TX_START()". Can be called from interrupt.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void led_frame_tx_done(void)
+    {
+        gb_frame_tx_busy = false;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_PIXEL_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Pixel stream transfer completed
+    *
+    * @note     Shall be called by user on completion of transfer started by
+    *           "LED_CFG_PIXEL_TX_START()". Can be called from interrupt.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void led_pixel_tx_done(void)
+    {
+        gb_pixel_tx_busy = false;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_BCM_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       BCM timer interrupt handler
+    *
+    * @note     Shall be called by user from BCM timer interrupt. Outputs
+    *           next bit-plane to GPIO ports and sets its duration, which
+    *           doubles with each bit-plane.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void led_bcm_isr(void)
+    {
+        uint8_t bit = g_bcm_bit;
+
+        // Take over new schedule at start of BCM cycle
+        if  (   ( 0U == bit )
+            &&  ( true == gb_bcm_is_ready ))
+        {
+            g_bcm_rd        = (uint8_t) ( g_bcm_rd ^ 1U );
+            gb_bcm_is_ready = false;
+        }
+
+        for ( uint8_t port = 0; port < LED_CFG_BCM_PORT_NUM_OF; port++ )
+        {
+            LED_CFG_BCM_PORT_WRITE( port, g_bcm_plane[ g_bcm_rd ][bit][port], ( g_bcm_port_mask[port] & ~g_bcm_plane[ g_bcm_rd ][bit][port] ));
+        }
+
+        LED_CFG_BCM_TIMER_SET( 1UL << bit );
+
+        bit++;
+        g_bcm_bit = ( bit < LED_CFG_BCM_BIT_NUM_OF ) ? ( bit ) : ( 0U );
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Asynchronous driver batch completed
+    *
+    * @note     Shall be called by user on completion of batch submitted by
+    *           "LED_CFG_ASYNC_SUBMIT()". Can be called from interrupt.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void led_async_done(void)
+    {
+        gb_async_busy = false;
+    }
+
+#endif
+
+#if ( 1 == LED_PWM_USE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *   Set LED smooth mode (fade in/out)
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - LED enumeration
+    * @param[in]    state   - LED state
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_smooth(led_ctx_t * const p_ctx, const uint16_t num, const led_state_t state)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( num < p_ctx->num_of );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if ( num < p_ctx->num_of )
+            {
+                led_activate( p_ctx, num );
+                led_smooth_start( p_ctx, num, state );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *   Put LED into smooth blink mode (fade in/out)
+    *
+    * @param[in]    p_ctx   - LED instance
+    * @param[in]    num     - Number of LED
+    * @param[in]    on_time - Time that LED will be turned ON
+    * @param[in]    period  - Period of blink
+    * @param[in]    blink   - Number of blinks
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_blink_smooth(led_ctx_t * const p_ctx, const uint16_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+    {
+        led_status_t status = eLED_OK;
+
+        const led_time_t on_time_t  = LED_TIME_FROM_S( on_time );
+        const led_time_t period_t   = LED_TIME_FROM_S( period );
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( num < p_ctx->num_of );
+        LED_ASSERT( on_time_t < period_t );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if  (   ( num < p_ctx->num_of )
+                &&  ( on_time_t < period_t )
+                &&  ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode ))
+            {
+                led_activate( p_ctx, num );
+                led_blink_start( p_ctx, num, eLED_MODE_FADE_BLINK, on_time_t, period_t, period, blink );
+            }
+            else
+            {
+                status = eLED_ERROR;
+            }
+        }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Configure LED fade timings and brightness
+    *
+    * @param[in]    p_ctx       - LED instance
+    * @param[in]    num         - LED number
+    * @param[in]    p_fade_cfg  - Fading configuration
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ctx_set_fade_cfg(led_ctx_t * const p_ctx, const uint16_t num, const led_fade_cfg_t * const p_fade_cfg)
+    {
+        led_status_t status = eLED_OK;
+
+        LED_ASSERT( true == LED_CTX_IS_INIT( p_ctx ));
+        LED_ASSERT( num < p_ctx->num_of );
+        LED_ASSERT( NULL != p_fade_cfg );
+
+        if ( true == LED_CTX_IS_INIT( p_ctx ))
+        {
+            if  (   ( num < p_ctx->num_of )
+                &&  ( NULL != p_fade_cfg )
+                &&  ( eLED_MODE_NORMAL == p_ctx->p_led[num].mode ))
             {
-                state = eGPIO_HIGH;
+                #if ( 1 == LED_FADE_PROFILE_EN )
+
+                    if ( true == led_fade_profile_acquire( p_ctx, num, LED_DUTY_FROM_F( p_fade_cfg->max_duty ), LED_TIME_FROM_S( p_fade_cfg->fade_in_time ), LED_TIME_FROM_S( p_fade_cfg->fade_out_time )))
+                    {
+                        p_ctx->p_led[num].max_duty = p_ctx->fade_profile[ p_ctx->p_led[num].fade_profile ].max_duty;
+                    }
+                    else
+                    {
+                        LED_DBG_PRINT( "LED: No free fading profile error!" );
+                        status = eLED_ERROR;
+                    }
+
+                #else
+                    p_ctx->p_led[num].max_duty         = LED_DUTY_FROM_F( p_fade_cfg->max_duty );
+                    p_ctx->p_led[num].fade_in_k        = led_calc_fade_k( p_ctx->p_led[num].max_duty, LED_TIME_FROM_S( p_fade_cfg->fade_in_time ));
+                    p_ctx->p_led[num].fade_out_k       = led_calc_fade_k( p_ctx->p_led[num].max_duty, LED_TIME_FROM_S( p_fade_cfg->fade_out_time ));
+                    p_ctx->p_led[num].fade_out_time    = LED_TIME_FROM_S( p_fade_cfg->fade_out_time );
+                #endif
+
+                // Maximum duty changed - re-evaluate output
+                p_ctx->p_led[num].is_dirty = true;
+                led_activate( p_ctx, num );
             }
             else
             {
-                state = eGPIO_LOW;
+                status = eLED_ERROR;
             }
         }
+        else
+        {
+            status = eLED_ERROR_INIT;
+        }
 
-        // Set GPIO
-        gpio_set( gp_cfg_table[led_num].drv_ch.gpio_pin, state );
+        return status;
+    }
 
-    #else
-        (void) led_num;
-        (void) duty;
-        (void) max_duty;
-    #endif
-}
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set led via TIMER driver
+*       Initialize LEDs
 *
-* @param[in]    led_num     - Number of LED
-* @param[in]    duty        - Current duty of LED
-* @return       void
+* @pre     Timers/GPIO shall be initialized before calling that function!
+*
+* @note     Default instance uses configuration table of "led_cfg_get_table()".
+*
+* @return   status - Status of initialisation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void led_set_timer(const led_num_t led_num, const float32_t duty)
+led_status_t led_init(void)
 {
-    #if ( 1 == LED_CFG_TIMER_USE_EN )
-
-        float32_t tim_duty = duty;
-
-        // Apply polarity
-        if ( eLED_POL_ACTIVE_LOW == gp_cfg_table[led_num].polarity )
-        {
-            tim_duty = ( 1.0f - duty );
-
-            if ( tim_duty < 0.0f )
-            {
-                tim_duty = 0.0f;
-            }
-        }
-
-        // Set timer PWM
-        timer_pwm_set( gp_cfg_table[led_num].drv_ch.tim_ch, tim_duty );
-
-    #else
-        (void) led_num;
-        (void) duty;
-    #endif
+    return led_ctx_init( &g_led_ctx, led_cfg_get_table(), g_led, (uint16_t) eLED_NUM_OF );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set LED via low level driver
+*       De-Initialize LEDs
 *
-* @param[in]    led_num     - Number of LED
-* @param[in]    duty        - Current duty of LED
-* @param[in]    max_duty    - Maximum duty of LED
-* @return       void
+* @note     Operates on default instance.
+*
+* @return   status - Status of de-init
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void led_set_low(const led_num_t led_num, const float32_t duty, const float32_t max_duty)
+led_status_t led_deinit(void)
 {
-    // Set timer
-    if ( eLED_DRV_TIMER_PWM == gp_cfg_table[led_num].drv_type )
-    {
-        led_set_timer( led_num, duty );
-    }
-
-    // Set GPIO
-    else if ( eLED_DRV_GPIO == gp_cfg_table[led_num].drv_type )
-    {
-        led_set_gpio( led_num, duty, max_duty );
-    }
-
-    // Unknown driver
-    else
-    {
-        LED_ASSERT( 0 );
-    }
+    return led_ctx_deinit( &g_led_ctx );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
-*/
-////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*@addtogroup LED_API
-* @{ <!-- BEGIN GROUP -->
+*   Get LED initialisation flag
 *
-*     Following functions are part of API calls.
+* @note     Operates on default instance.
+*
+* @param[out]   p_is_init   - Initialisation flag
+* @return       status      - Status of initialisation
 */
 ////////////////////////////////////////////////////////////////////////////////
+led_status_t led_is_init(bool * const p_is_init)
+{
+    return led_ctx_is_init( &g_led_ctx, p_is_init );
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Initialize LEDs
+*       LED handler
 *
-* @pre     Timers/GPIO shall be initialized before calling that function!
+* @note     Operates on default instance.
 *
-* @return   status - Status of initialisation
+* @return   status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-led_status_t led_init(void)
+led_status_t led_hndl(void)
 {
-    led_status_t status = eLED_OK;
-
-    // Prevent multiple inits
-    if ( false == gb_is_init )
-    {
-        // Get configuration matrix
-        gp_cfg_table = led_cfg_get_table();
-
-        if ( NULL != gp_cfg_table )
-        {
-            // Check low level drivers
-            if ( eLED_OK == led_check_drv_init())
-            {
-                // Set init success
-                gb_is_init = true;
-
-                // Set up live LED configuration
-                for ( led_num_t num = 0; num < eLED_NUM_OF; num++ )
-                {
-                    g_led[num].duty             = 0.0f;
-                    g_led[num].max_duty         = 1.0f;
-                    g_led[num].fade_time        = 0.0f;
-                    g_led[num].fade_in_k        = LED_FADE_IN_COEF_T_TO_DUTY;
-                    g_led[num].fade_out_k       = LED_FADE_OUT_COEF_T_TO_DUTY;
-                    g_led[num].fade_out_time    = 1.0f;
-                    g_led[num].period           = 0.0f;
-                    g_led[num].per_time         = 0.0f;
-                    g_led[num].on_time          = 0.0f;
-                    g_led[num].active_time      = 0.0f;
-                    g_led[num].mode             = eLED_MODE_NORMAL;
-                    g_led[num].blink_cnt        = 0;
-
-                    // Set LED initial value
-                    led_set( num, gp_cfg_table[num].initial_state );
-                    led_set_low( num, g_led[num].duty, g_led[num].max_duty );
-                }
-            }
-
-            // Low level drivers not initialised
-            else
-            {
-                LED_DBG_PRINT( "LED: Low level drivers not initialised error!" );
-                LED_ASSERT( 0 );
-                status = eLED_ERROR_INIT;
-            }
-        }
-        else
-        {
-            LED_DBG_PRINT( "LED: Config table unknown error!" );
-            LED_ASSERT( 0 );
-            status = eLED_ERROR_INIT;
-        }
-    }
-
-    return status;
+    return led_ctx_hndl( &g_led_ctx );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       De-Initialize LEDs
+*       LED handler with variable elapsed time
 *
-* @return   status - Status of de-init
+* @note     Operates on default instance.
+*
+* @param[in]    dt      - Elapsed time since last handler call
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-led_status_t led_deinit(void)
+led_status_t led_hndl_elapsed(const float32_t dt)
 {
-    led_status_t status = eLED_OK;
-
-    if ( true == gb_is_init )
-    {
-        // Set all LEDs to initial state
-        for ( led_num_t num = 0; num < eLED_NUM_OF; num++ )
-        {
-            led_set( num, gp_cfg_table[num].initial_state );
-        }
-
-        // De-init success
-        gb_is_init = false;
-    }
-
-    return status;
+    return led_ctx_hndl_elapsed( &g_led_ctx, dt );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Get LED initialisation flag
+*       Get time until next required LED handler call
 *
-* @param[out]   p_is_init   - Initialisation flag
-* @return       status      - Status of initialisation
+* @note     Operates on default instance.
+*
+* @param[out]   p_time  - Time till next handler call
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-led_status_t led_is_init(bool * const p_is_init)
+led_status_t led_get_next_deadline(float32_t * const p_time)
 {
-    led_status_t status = eLED_OK;
-
-    if ( NULL != p_is_init )
-    {
-        *p_is_init = gb_is_init;
-    }
-    else
-    {
-        status = eLED_ERROR;
-    }
-
-    return status;
+    return led_ctx_get_next_deadline( &g_led_ctx, p_time );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       LED handler
+*       Get currently required LED handler rate
 *
-* @note     This function shall be called with constant period of value
-*           set in "led_cfg.h" with macro "LED_CFG_HNDL_PERIOD_S".
+* @note     Operates on default instance.
 *
-* @return   status  - Status of operation
+* @param[out]   p_rate  - Required handler rate in Hz
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-led_status_t led_hndl(void)
+led_status_t led_get_hndl_rate(float32_t * const p_rate)
 {
-    led_status_t status = eLED_OK;
-
-    LED_ASSERT( true == gb_is_init );
-
-    if ( true == gb_is_init )
-    {
-        // Loop through all LEDs
-        for ( uint8_t led_num = 0; led_num < eLED_NUM_OF; led_num++ )
-        {
-            switch( g_led[led_num].mode )
-            {
-                case eLED_MODE_NORMAL:
-                case eLED_MODE_FADE_TOGGLE:
-                    // No action...
-                    break;
-
-                case eLED_MODE_FADE_IN:
-                    led_fade_in_hndl( led_num, eLED_MODE_NORMAL );
-                    break;
-
-                case eLED_MODE_FADE_OUT:
-                    led_fade_out_hndl( led_num, eLED_MODE_NORMAL );
-                    break;
-
-                case eLED_MODE_BLINK:
-                    led_blink_hndl( led_num );
-                    break;
-
-                case eLED_MODE_FADE_BLINK:
-                    led_fade_blink_hndl( led_num );
-                    break;
-
-                case eLED_MODE_NUM_OF:
-                default:
-                    LED_ASSERT( 0 );
-                    break;
-            }
-
-            // Set LED low level driver
-            led_set_low( led_num, g_led[led_num].duty, g_led[led_num].max_duty );
-
-            // Manage period time
-            led_hndl_period_time( led_num );
-
-            // Manage LED timings
-            led_manage_time( led_num );
-        }
-    }
-    else
-    {
-        status = eLED_ERROR_INIT;
-    }
-
-    return status;
+    return led_ctx_get_hndl_rate( &g_led_ctx, p_rate );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Set LED state
 *
+* @note     Operates on default instance.
+*
 * @param[in]    num     - LED enumeration number
 * @param[in]    state   - State of LED
 * @return       status  - Status of operation
@@ -756,138 +7230,48 @@ led_status_t led_hndl(void)
 ////////////////////////////////////////////////////////////////////////////////
 led_status_t led_set(const led_num_t num, const led_state_t state)
 {
-    led_status_t status = eLED_OK;
-
-    LED_ASSERT( true == gb_is_init );
-    LED_ASSERT( num < eLED_NUM_OF );
-
-    if ( true == gb_is_init )
-    {
-        if ( num < eLED_NUM_OF )
-        {
-            g_led[num].mode = eLED_MODE_NORMAL;
-
-            if ( eLED_ON == state )
-            {
-                g_led[num].duty = g_led[num].max_duty;
-            }
-            else
-            {
-                g_led[num].duty = 0.0f;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR;
-        }
-    }
-    else
-    {
-        status = eLED_ERROR_INIT;
-    }
-
-    return status;
+    return led_ctx_set( &g_led_ctx, (uint16_t) num, state );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Toggle LED
 *
+* @note     Operates on default instance.
+*
 * @param[in]    num     - LED enumeration number
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
 led_status_t led_toggle(const led_num_t num)
 {
-    led_status_t status = eLED_OK;
-
-    LED_ASSERT( true == gb_is_init );
-    LED_ASSERT( num < eLED_NUM_OF );
-
-    if ( true == gb_is_init )
-    {
-        if ( num < eLED_NUM_OF )
-        {
-            g_led[num].mode = eLED_MODE_NORMAL;
-
-            if ( g_led[num].duty >= g_led[num].max_duty )
-            {
-                g_led[num].duty = 0.0f;
-            }
-            else
-            {
-                g_led[num].duty = g_led[num].max_duty ;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR;
-        }
-    }
-    else
-    {
-        status = eLED_ERROR_INIT;
-    }
-
-    return status;
+    return led_ctx_toggle( &g_led_ctx, (uint16_t) num );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *   Put LED into blink mode
 *
-* @param[in]    num     - Number of LED
-* @param[in]    on_time - Time that LED will be turned ON
-* @param[in]    period  - Period of blink
-* @param[in]    blink   - Number of blinks
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-led_status_t led_blink(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
-{
-    led_status_t status = eLED_OK;
-
-    LED_ASSERT( true == gb_is_init );
-    LED_ASSERT( num < eLED_NUM_OF );
-    LED_ASSERT( on_time < period  );
-
-    if ( true == gb_is_init )
-    {
-        if  (   ( num < eLED_NUM_OF )
-            &&  ( on_time < period )
-            &&  ( eLED_MODE_NORMAL == g_led[num].mode ))
-        {
-            g_led[num].mode     = eLED_MODE_BLINK;
-            g_led[num].on_time  = on_time;
-            g_led[num].period   = period;
-            g_led[num].per_time = 0.0f;
-
-            if ( eLED_BLINK_CONTINUOUS == blink )
-            {
-                g_led[num].blink_cnt = LED_BLINK_CNT_CONT_VAL;
-            }
-            else
-            {
-                g_led[num].blink_cnt = (uint8_t) blink;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR;
-        }
-    }
-    else
-    {
-        status = eLED_ERROR_INIT;
-    }
-
-    return status;
+* @note     Operates on default instance.
+*
+* @param[in]    num     - Number of LED
+* @param[in]    on_time - Time that LED will be turned ON
+* @param[in]    period  - Period of blink
+* @param[in]    blink   - Number of blinks
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+led_status_t led_blink(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
+{
+    return led_ctx_blink( &g_led_ctx, (uint16_t) num, on_time, period, blink );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Get LED active (ON) time
 *
+* @note     Operates on default instance.
+*
 * @param[in]    num             - LED number
 * @param[out]   p_active_time   - Pointer to LED active time
 * @return       status          - Status of operation
@@ -895,37 +7279,14 @@ led_status_t led_blink(const led_num_t num, const float32_t on_time, const float
 ////////////////////////////////////////////////////////////////////////////////
 led_status_t led_get_active_time(const led_num_t num, float32_t * const p_active_time)
 {
-    led_status_t status = eLED_OK;
-
-    LED_ASSERT( true == gb_is_init );
-    LED_ASSERT( num < eLED_NUM_OF );
-    LED_ASSERT( NULL != p_active_time );
-
-    if ( true == gb_is_init )
-    {
-        if  (   ( num < eLED_NUM_OF )
-            &&  ( NULL != p_active_time ))
-        {
-            *p_active_time = g_led[num].active_time;
-        }
-        else
-        {
-            status = eLED_ERROR;
-        }
-    }
-    else
-    {
-        status = eLED_ERROR_INIT;
-    }
-
-    return status;
+    return led_ctx_get_active_time( &g_led_ctx, (uint16_t) num, p_active_time );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Is LED in idle state
 *
-* @brief    Get if LED is in idle state, meaning that it no longer blinks!
+* @note     Operates on default instance.
 *
 * @param[in]    num         - LED number
 * @param[out]   p_is_idle   - Is LED in idle state
@@ -934,45 +7295,227 @@ led_status_t led_get_active_time(const led_num_t num, float32_t * const p_active
 ////////////////////////////////////////////////////////////////////////////////
 led_status_t led_is_idle(const led_num_t num, bool * const p_is_idle)
 {
-    led_status_t status = eLED_OK;
+    return led_ctx_is_idle( &g_led_ctx, (uint16_t) num, p_is_idle );
+}
 
-    LED_ASSERT( true == gb_is_init );
-    LED_ASSERT( num < eLED_NUM_OF );
-    LED_ASSERT( NULL != p_is_idle );
+#if ( 1 == LED_CFG_SEQ_EN )
 
-    if ( true == gb_is_init )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Run LED sequence
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    num     - LED number
+    * @param[in]    p_seq   - Pointer to sequence
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_sequence(const led_num_t num, const led_seq_step_t * const p_seq)
     {
-        if  (   ( num < eLED_NUM_OF )
-            &&  ( NULL != p_is_idle ))
-        {
-            if ( eLED_MODE_NORMAL == g_led[num].mode )
-            {
-                *p_is_idle = true;
-            }
-            else
-            {
-                *p_is_idle = false;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR;
-        }
+        return led_ctx_sequence( &g_led_ctx, (uint16_t) num, p_seq );
     }
-    else
+
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Ramp LED duty to target
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    num     - LED number
+    * @param[in]    duty    - Target duty cycle, range: [0.0 - 1.0]
+    * @param[in]    time    - Ramp time
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_ramp_to(const led_num_t num, const float32_t duty, const float32_t time)
     {
-        status = eLED_ERROR_INIT;
+        return led_ctx_ramp_to( &g_led_ctx, (uint16_t) num, duty, time );
     }
 
-    return status;
-}
+#endif
 
-#if ( 1 == LED_CFG_TIMER_USE_EN )
+#if ( 1 == LED_CFG_BULK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set state of many LEDs by bitmap
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    p_mask  - Bitmap of LEDs to set
+    * @param[in]    p_state - Bitmap of LED states, set bit for ON
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_set_mask(const uint32_t * const p_mask, const uint32_t * const p_state)
+    {
+        return led_ctx_set_mask( &g_led_ctx, p_mask, p_state );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set state of many consecutive LEDs
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    first   - First LED
+    * @param[in]    p_state - States of LEDs
+    * @param[in]    num_of  - Number of LEDs
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_set_many(const led_num_t first, const led_state_t * const p_state, const uint16_t num_of)
+    {
+        return led_ctx_set_many( &g_led_ctx, (uint16_t) first, p_state, num_of );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Take snapshot of all LEDs
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[out]   p_snap  - Snapshot of LEDs
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_snapshot(led_snapshot_t * const p_snap)
+    {
+        return led_ctx_snapshot( &g_led_ctx, p_snap );
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set LED event subscription
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    num     - LED number
+    * @param[in]    mask    - Subscribed events, "led_event_t" bits
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_set_event_mask(const led_num_t num, const uint8_t mask)
+    {
+        return led_ctx_set_event_mask( &g_led_ctx, (uint16_t) num, mask );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set global event subscription
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    mask    - Subscribed events, "led_event_t" bits
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_set_event_mask_global(const uint8_t mask)
+    {
+        return led_ctx_set_event_mask_global( &g_led_ctx, mask );
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set global brightness
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[in]    brightness  - Global brightness in range of [0.0 - 1.0]
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_set_brightness(const float32_t brightness)
+    {
+        return led_ctx_set_brightness( &g_led_ctx, brightness );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get global brightness
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[out]   p_brightness    - Global brightness
+    * @return       status          - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_get_brightness(float32_t * const p_brightness)
+    {
+        return led_ctx_get_brightness( &g_led_ctx, p_brightness );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get estimated LED current
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[out]   p_current   - Estimated current of all LEDs in mA
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_get_current(float32_t * const p_current)
+    {
+        return led_ctx_get_current( &g_led_ctx, p_current );
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get LED handler statistics
+    *
+    * @note     Operates on default instance.
+    *
+    * @param[out]   p_stats - Pointer to statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_get_stats(led_stats_t * const p_stats)
+    {
+        return led_ctx_get_stats( &g_led_ctx, p_stats );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset LED handler statistics
+    *
+    * @note     Operates on default instance.
+    *
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    led_status_t led_reset_stats(void)
+    {
+        return led_ctx_reset_stats( &g_led_ctx );
+    }
+
+#endif
+
+#if ( 1 == LED_PWM_USE_EN )
 
     ////////////////////////////////////////////////////////////////////////////////
     /**
     *   Set LED smooth mode (fade in/out)
     *
+    * @note     Operates on default instance.
+    *
     * @param[in]    num     - LED enumeration
     * @param[in]    state   - LED state
     * @return       status  - Status of operation
@@ -980,41 +7523,15 @@ led_status_t led_is_idle(const led_num_t num, bool * const p_is_idle)
     ////////////////////////////////////////////////////////////////////////////////
     led_status_t led_set_smooth(const led_num_t num, const led_state_t state)
     {
-        led_status_t status = eLED_OK;
-
-        LED_ASSERT( true == gb_is_init );
-        LED_ASSERT( num < eLED_NUM_OF );
-
-        if ( true == gb_is_init )
-        {
-            if ( num < eLED_NUM_OF )
-            {
-                if ( eLED_ON == state )
-                {
-                    g_led[num].mode = eLED_MODE_FADE_IN;
-                }
-                else
-                {
-                    g_led[num].mode = eLED_MODE_FADE_OUT;
-                }
-            }
-            else
-            {
-                status = eLED_ERROR;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR_INIT;
-        }
-
-        return status;
+        return led_ctx_set_smooth( &g_led_ctx, (uint16_t) num, state );
     }
 
     ////////////////////////////////////////////////////////////////////////////////
     /**
     *   Put LED into smooth blink mode (fade in/out)
     *
+    * @note     Operates on default instance.
+    *
     * @param[in]    num     - Number of LED
     * @param[in]    on_time - Time that LED will be turned ON
     * @param[in]    period  - Period of blink
@@ -1024,49 +7541,15 @@ led_status_t led_is_idle(const led_num_t num, bool * const p_is_idle)
     ////////////////////////////////////////////////////////////////////////////////
     led_status_t led_blink_smooth(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink)
     {
-        led_status_t status = eLED_OK;
-
-        LED_ASSERT( true == gb_is_init );
-        LED_ASSERT( num < eLED_NUM_OF );
-        LED_ASSERT( on_time < period);
-
-        if ( true == gb_is_init )
-        {
-            if  (   ( num < eLED_NUM_OF )
-                &&  ( on_time < period )
-                &&  ( eLED_MODE_NORMAL == g_led[num].mode ))
-            {
-                g_led[num].mode     = eLED_MODE_FADE_BLINK;
-                g_led[num].on_time  = on_time;
-                g_led[num].period   = period;
-                g_led[num].per_time = 0.0f;
-
-                if ( eLED_BLINK_CONTINUOUS == blink )
-                {
-                    g_led[num].blink_cnt = LED_BLINK_CNT_CONT_VAL;
-                }
-                else
-                {
-                    g_led[num].blink_cnt = (uint8_t) blink;
-                }
-            }
-            else
-            {
-                status = eLED_ERROR;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR_INIT;
-        }
-
-        return status;
+        return led_ctx_blink_smooth( &g_led_ctx, (uint16_t) num, on_time, period, blink );
     }
 
     ////////////////////////////////////////////////////////////////////////////////
     /**
     *       Configure LED fade timings and brightness
     *
+    * @note     Operates on default instance.
+    *
     * @param[in]    num         - LED number
     * @param[in]    p_fade_cfg  - Fading configuration
     * @return       status      - Status of operation
@@ -1074,38 +7557,10 @@ led_status_t led_is_idle(const led_num_t num, bool * const p_is_idle)
     ////////////////////////////////////////////////////////////////////////////////
     led_status_t led_set_fade_cfg(const led_num_t num, const led_fade_cfg_t * const p_fade_cfg)
     {
-        led_status_t status = eLED_OK;
-
-        LED_ASSERT( true == gb_is_init );
-        LED_ASSERT( num < eLED_NUM_OF );
-        LED_ASSERT( NULL != p_fade_cfg );
-
-        if ( true == gb_is_init )
-        {
-            if  (   ( num < eLED_NUM_OF )
-                &&  ( NULL != p_fade_cfg )
-                &&  ( eLED_MODE_NORMAL == g_led[num].mode ))
-            {
-                g_led[num].max_duty         = p_fade_cfg->max_duty;
-                g_led[num].fade_in_k        = (float32_t) ( 2.0f * g_led[num].max_duty / ( p_fade_cfg->fade_in_time * p_fade_cfg->fade_in_time ));
-                g_led[num].fade_out_k       = (float32_t) ( 2.0f * g_led[num].max_duty / ( p_fade_cfg->fade_out_time * p_fade_cfg->fade_out_time ));
-                g_led[num].fade_out_time    = p_fade_cfg->fade_out_time;
-            }
-            else
-            {
-                status = eLED_ERROR;
-            }
-        }
-        else
-        {
-            status = eLED_ERROR_INIT;
-        }
-
-        return status;
+        return led_ctx_set_fade_cfg( &g_led_ctx, (uint16_t) num, p_fade_cfg );
     }
 
 #endif
-
 ////////////////////////////////////////////////////////////////////////////////
 /*!
  * @} <!-- END GROUP -->
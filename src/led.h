@@ -7,8 +7,8 @@
 * @brief    LED manipulations
 * @author   Ziga Miklosic
 * @email    ziga.miklosic@gmail.com
-* @date     08.11.2023
-* @version  V1.1.0
+* @date     14.10.2026
+* @version  V1.2.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -35,12 +35,34 @@
  *     Module version
  */
 #define LED_VER_MAJOR       ( 1 )
-#define LED_VER_MINOR       ( 1 )
+#define LED_VER_MINOR       ( 2 )
 #define LED_VER_DEVELOP     ( 0 )
 
 // Float definition
 typedef float float32_t;
 
+/**
+ *     Fading API availability
+ *
+ * @note    Fading is supported by all low level drivers with
+ *          duty cycle resolution (timer PWM, pixel, BCM and
+ *          asynchronous).
+ */
+#if (( 1 == LED_CFG_TIMER_USE_EN ) || ( 1 == LED_CFG_PIXEL_USE_EN ) || ( 1 == LED_CFG_BCM_USE_EN ) || ( 1 == LED_CFG_ASYNC_USE_EN ))
+    #define LED_PWM_USE_EN      ( 1 )
+#else
+    #define LED_PWM_USE_EN      ( 0 )
+#endif
+
+/**
+ *     No LED handler deadline
+ *
+ * @note    Returned by "led_get_next_deadline()" when all LEDs are static.
+ *
+ *     Unit: sec
+ */
+#define LED_DEADLINE_NONE_S     ( 1E6f )
+
 /**
  *     LED status
  */
@@ -61,12 +83,40 @@ typedef enum
     eLED_BLINK_3X,
     eLED_BLINK_4X,
     eLED_BLINK_5X,
-    eLED_BLINK_CONTINUOUS,
+    eLED_BLINK_CONTINUOUS = 0xFF,
 
     eLED_BLINK_NUM_OF
 } led_blink_t;
 
-#if ( 1 == LED_CFG_TIMER_USE_EN )
+/**
+ *     Finite number of blinks
+ *
+ * @note    Any number of blinks in range [1, 255] can be used
+ *          in place of "led_blink_t", e.g. LED_BLINK_CNT( 12 ).
+ */
+#define LED_BLINK_CNT(cnt)      ((led_blink_t) (( cnt ) - 1U ))
+
+#if ( 1 == LED_CFG_EVENT_EN )
+
+    /**
+     *  LED events
+     *
+     * @note    Bit per event, so events can be combined into subscription mask.
+     */
+    typedef enum
+    {
+        eLED_EVENT_FADE_IN_DONE     = 0x01U,    /**<Fade in finished */
+        eLED_EVENT_FADE_OUT_DONE    = 0x02U,    /**<Fade out finished */
+        eLED_EVENT_BLINK_DONE       = 0x04U,    /**<Finite blinking finished */
+        eLED_EVENT_SEQ_DONE         = 0x08U,    /**<Sequence finished */
+        eLED_EVENT_RAMP_DONE        = 0x10U,    /**<Ramp reached target duty */
+
+        eLED_EVENT_ALL              = 0x1FU,    /**<All events */
+    } led_event_t;
+
+#endif
+
+#if ( 1 == LED_PWM_USE_EN )
 
     /**
      *     LED fade configuration
@@ -80,6 +130,366 @@ typedef enum
 
 #endif
 
+#if ( 1 == LED_CFG_SEQ_EN )
+
+    /**
+     *     Sequence step operation
+     */
+    typedef enum
+    {
+        eLED_SEQ_OP_END = 0,    /**<End of sequence, LED keeps last duty */
+        eLED_SEQ_OP_SET,        /**<Set duty and hold it for step time */
+        eLED_SEQ_OP_LINEAR,     /**<Linear ramp to duty in step time */
+        eLED_SEQ_OP_SQUARE,     /**<Square ramp to duty in step time */
+        eLED_SEQ_OP_JUMP,       /**<Jump to step, repeat times (0 - forever), counted jumps can be nested */
+    } led_seq_op_t;
+
+    /**
+     *     Sequence step
+     *
+     * @note    Duty is in range of [0, 255] and is scaled by LED maximum
+     *          duty. Time is in number of handler periods. For jump
+     *          operation duty holds repeat count and time target step.
+     */
+    typedef struct
+    {
+        uint8_t     op;     /**<Step operation, "led_seq_op_t" */
+        uint8_t     duty;   /**<Target duty or jump repeat count */
+        uint16_t    time;   /**<Step time or jump target step */
+    } led_seq_step_t;
+
+    /**
+     *     Sequence step definitions
+     */
+    #define LED_SEQ_SET(duty,time)          { eLED_SEQ_OP_SET,      ( duty ),   ( time ) }
+    #define LED_SEQ_LINEAR(duty,time)       { eLED_SEQ_OP_LINEAR,   ( duty ),   ( time ) }
+    #define LED_SEQ_SQUARE(duty,time)       { eLED_SEQ_OP_SQUARE,   ( duty ),   ( time ) }
+    #define LED_SEQ_JUMP(step,repeat)       { eLED_SEQ_OP_JUMP,     ( repeat ), ( step ) }
+    #define LED_SEQ_END()                   { eLED_SEQ_OP_END,      0U,         0U }
+
+    /**
+     *     Sequence time from seconds
+     */
+    #define LED_SEQ_TIME(time)              ((uint16_t) (( time ) / LED_CFG_HNDL_PERIOD_S + 0.5f ))
+
+#endif
+
+#if ( 1 == LED_CFG_ASYNC_USE_EN )
+
+    /**
+     *     Asynchronous driver batch item
+     */
+    typedef struct
+    {
+        uint16_t ch;        /**<Asynchronous driver channel */
+        uint16_t value;     /**<Channel value in range of [0, LED_CFG_ASYNC_RES] */
+    } led_async_item_t;
+
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+
+    /**
+     *     LED handler statistics
+     */
+    typedef struct
+    {
+        uint32_t hndl_cnt;                             /**<Number of handler calls */
+        uint32_t cycle_min;                            /**<Minimum handler execution cycles */
+        uint32_t cycle_max;                            /**<Maximum handler execution cycles */
+        uint32_t cycle_avg;                            /**<Average handler execution cycles */
+        uint32_t gpio_cnt;                             /**<Number of GPIO driver calls */
+        uint32_t timer_cnt;                            /**<Number of timer PWM driver calls */
+        uint32_t gpio_port_cnt;                        /**<Number of GPIO port writes */
+        uint32_t tx_cnt;                               /**<Number of frame, pixel and asynchronous driver transfers */
+        uint32_t mode_cnt[ LED_CFG_CTX_LED_NUM_OF ];   /**<Number of mode transitions per LED */
+    } led_stats_t;
+
+#endif
+
+/**
+ *     Time and duty cycle representation
+ *
+ * @note    Fixed point engine keeps time in number of handler periods
+ *          (ticks) and duty as unsigned Q16 value, where 0xFFFF equals
+ *          to 100 %. Otherwise time is kept in seconds and duty in
+ *          range of [0.0 - 1.0].
+ */
+#if ( 1 == LED_CFG_FIXED_POINT_EN )
+    typedef uint32_t    led_time_t;
+    typedef uint16_t    led_duty_t;
+    typedef uint32_t    led_fade_k_t;
+#else
+    typedef float32_t   led_time_t;
+    typedef float32_t   led_duty_t;
+    typedef float32_t   led_fade_k_t;
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+
+    /**
+     *     Ramp duty increment
+     *
+     *  @note   Signed duty change per unit of time, in Q15 format
+     *          with fixed point engine.
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        typedef int32_t     led_ramp_inc_t;
+    #else
+        typedef float32_t   led_ramp_inc_t;
+    #endif
+
+#endif
+
+#if ( 1 == LED_CFG_FADE_LUT_EN )
+
+    /**
+     *     Position on fading curve
+     *
+     *  @note   Lookup table index in Q16 format with fixed point engine,
+     *          otherwise lookup table index with fractional part.
+     */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        typedef uint32_t    led_fade_pos_t;
+    #else
+        typedef float32_t   led_fade_pos_t;
+    #endif
+
+#endif
+
+/**
+ *     Shared fading profiles
+ *
+ * @note    Fading parameters are kept in profiles shared by all LEDs
+ *          of instance with same fading configuration instead of inside
+ *          LED data.
+ */
+#if (( 1 == LED_PWM_USE_EN ) && (( 1 == LED_CFG_FADE_LUT_EN ) || ( 1 == LED_CFG_COMPACT_EN )))
+    #define LED_FADE_PROFILE_EN             ( 1 )
+#else
+    #define LED_FADE_PROFILE_EN             ( 0 )
+#endif
+
+#if ( 1 == LED_FADE_PROFILE_EN )
+
+    /**
+     *     Fading profile
+     *
+     * @note    Fading curve is x^2 characteristics scaled to maximum duty,
+     *          where fade in moves forward and fade out backward on it.
+     */
+    typedef struct
+    {
+    #if ( 1 == LED_CFG_FADE_LUT_EN )
+        led_duty_t      lut[ LED_CFG_FADE_LUT_SIZE ];   /**<Fading curve */
+        led_fade_pos_t  in_inc;         /**<Fade in curve position increment per unit of time */
+        led_fade_pos_t  out_inc;        /**<Fade out curve position increment per unit of time */
+    #else
+        led_fade_k_t    fade_in_k;      /**<Fade in factor */
+        led_fade_k_t    fade_out_k;     /**<Fade out factor */
+        led_time_t      fade_out_time;  /**<Time for fading out */
+    #endif
+        led_duty_t      max_duty;       /**<Maximum duty cycle */
+        uint8_t         ref_cnt;        /**<Number of LEDs using profile */
+    } led_fade_profile_t;
+
+#endif
+
+/**
+ *     LED mode
+ */
+typedef enum
+{
+    eLED_MODE_NORMAL = 0,       /**<Normal mode */
+    eLED_MODE_FADE_IN,          /**<Fade-in mode */
+    eLED_MODE_FADE_OUT,         /**<Fade-out mode */
+    eLED_MODE_FADE_TOGGLE,      /**<Fade-in-out continuously */
+    eLED_MODE_BLINK,            /**<Blink mode */
+    eLED_MODE_FADE_BLINK,       /**<Blink mode with fading */
+    eLED_MODE_GROUP,            /**<Duty driven by group */
+    eLED_MODE_SEQUENCE,         /**<Sequence mode */
+    eLED_MODE_RAMP,             /**<Linear ramp to target duty */
+
+    eLED_MODE_NUM_OF
+} led_mode_t;
+
+/**
+ *     LED data
+ *
+ * @note    Fading state is present only when fading API is available
+ *          and fading parameters only when they are not shared inside
+ *          fading profiles. Byte sized members are kept at the end in
+ *          order to minimize padding.
+ *
+ * @note    Members are private to LED module. Type is visible only in
+ *          order to let caller allocate state buffer of LED instance.
+ */
+typedef struct
+{
+    led_duty_t      duty;           /**<Duty cycle of LED */
+    led_duty_t      max_duty;       /**<Maximum duty cycle of LED */
+#if ( 1 == LED_PWM_USE_EN )
+    #if ( 1 == LED_CFG_FADE_LUT_EN )
+        led_fade_pos_t  fade_pos;       /**<Position on fading curve */
+    #else
+        led_time_t      fade_time;      /**<Time for fading functionalities */
+    #endif
+    #if ( 0 == LED_FADE_PROFILE_EN )
+        led_fade_k_t    fade_in_k;      /**<Fade in factor */
+        led_fade_k_t    fade_out_k;     /**<Fade out factor */
+        led_time_t      fade_out_time;  /**<Time for fading out */
+    #endif
+#endif
+    led_time_t      period;         /**<Period of toggle mode */
+    led_time_t      per_time;       /**<Period time keeping */
+    led_time_t      on_time;        /**<On time for blink mode */
+    led_time_t      active_time;    /**<LED active time - turned ON time */
+    led_duty_t      out;            /**<Last output written to low level driver */
+    led_duty_t      out_duty;       /**<Duty cycle of last output stage pass */
+#if ( 1 == LED_CFG_SEQ_EN )
+    const led_seq_step_t * p_seq;   /**<Running sequence */
+    led_time_t      seq_time;       /**<Time inside current sequence step */
+    led_duty_t      seq_duty;       /**<Duty at start of current sequence step */
+    uint16_t        seq_pc;         /**<Current sequence step */
+    uint16_t        seq_loop_pc[ LED_CFG_SEQ_LOOP_DEPTH ];  /**<Jump step of running counted loops */
+    uint8_t         seq_loop[ LED_CFG_SEQ_LOOP_DEPTH ];     /**<Loop counters of running counted loops */
+    uint8_t         seq_depth;      /**<Number of running counted loops */
+#endif
+#if ( 1 == LED_CFG_RAMP_EN )
+    led_ramp_inc_t  ramp_inc;       /**<Ramp duty change per unit of time */
+    led_time_t      ramp_time;      /**<Remaining ramp time */
+    led_duty_t      ramp_target;    /**<Ramp target duty */
+#endif
+#if ( 1 == LED_CFG_GROUP_EN )
+    uint32_t        group_mask;     /**<Group membership */
+#endif
+#if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+    led_time_t      idle_mark;      /**<Active list clock at last active time evaluation */
+#endif
+#if ( 1 == LED_CFG_LIMIT_EN )
+    uint32_t        load;           /**<Estimated LED current at full brightness, mA/255 */
+#endif
+#if ( 1 == LED_CFG_TIMESTAMP_EN )
+    uint32_t        per_start;      /**<Timestamp of current blink period start */
+    uint32_t        period_ts;      /**<Period of toggle mode in timestamp ticks */
+#endif
+#if ( 1 == LED_CFG_COMPACT_EN )
+    uint8_t         mode;           /**<Current LED mode, "led_mode_t" */
+#else
+    led_mode_t      mode;           /**<Current LED mode */
+#endif
+    uint8_t         blink_cnt;      /**<Blink LED live counter */
+#if ( 0 == LED_CFG_TIMESTAMP_EN )
+    uint8_t         per_skip;       /**<Elapsed time skipped on first period update, "led_per_skip_t" */
+#endif
+    bool            is_dirty;       /**<Force low level driver write */
+    uint8_t         pol_xor;        /**<Output inversion resolved at init, 1 for active low */
+#if ( 1 == LED_FADE_PROFILE_EN )
+    uint8_t         fade_profile;   /**<Fading profile */
+#endif
+#if ( 1 == LED_CFG_GROUP_EN )
+    uint8_t         group;          /**<Group driving LED in group mode */
+#endif
+#if ( 1 == LED_CFG_EVENT_EN )
+    uint8_t         event_mask;     /**<Subscribed events, "led_event_t" bits */
+#endif
+#if ( 1 == LED_CFG_PHASE_EN )
+    uint8_t         phase_slot;     /**<Phase slot of timer PWM update */
+#endif
+#if ( 1 == LED_CFG_TIMER_DMA_EN )
+    uint8_t         dma_wave;       /**<Timer DMA waveform, "led_dma_wave_t" */
+    uint8_t         dma_buf;        /**<Timer DMA waveform buffer */
+#endif
+} led_t;
+
+/**
+ *     LED bitmap size
+ *
+ * @note    Number of 32-bit words of bitmap with single bit per LED.
+ */
+#define LED_MASK_NUM_OF                     (( LED_CFG_CTX_LED_NUM_OF + 31U ) / 32U )
+
+#if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+
+    /**
+     *     Active LED bitmap size
+     */
+    #define LED_ACTIVE_NUM_OF               ( LED_MASK_NUM_OF )
+
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+
+    /**
+     *     Snapshot of all LEDs
+     *
+     * @note    Bit per LED, LED number "num" is bit "num % 32" of word "num / 32".
+     */
+    typedef struct
+    {
+        uint32_t    on[ LED_MASK_NUM_OF ];      /**<LED is turned ON (duty above zero) */
+        uint32_t    idle[ LED_MASK_NUM_OF ];    /**<LED is in idle (normal) mode */
+    } led_snapshot_t;
+
+#endif
+
+/**
+ *     LED instance
+ *
+ * @note    Each instance has its own configuration table, state buffer
+ *          and time keeping, so instances can be handled from different
+ *          tasks at different rates without locking.
+ *
+ * @note    Members are private to LED module. Type is visible only in
+ *          order to let caller allocate LED instance.
+ */
+typedef struct
+{
+    led_t *                 p_led;              /**<LED data */
+    const led_cfg_t *       p_cfg;              /**<Configuration table */
+#if ( 1 == LED_CFG_REFRESH_EN )
+    led_time_t              refresh_time;       /**<Low level driver refresh time keeping */
+#endif
+#if ( 1 == LED_FADE_PROFILE_EN )
+    led_fade_profile_t      fade_profile[ LED_CFG_FADE_PROFILE_NUM_OF ];    /**<Fading profiles */
+#endif
+#if ( 1 == LED_CFG_ACTIVE_LIST_EN )
+    uint32_t                active[ LED_ACTIVE_NUM_OF ];                    /**<Active LEDs bitmap */
+    led_time_t              clock;              /**<Active list clock */
+#endif
+#if ( 1 == LED_CFG_LIMIT_EN )
+    led_duty_t              brightness;         /**<Global brightness */
+    led_duty_t              limit_scale;        /**<Output scale of dimmable LEDs */
+    uint32_t                limit_load_dim;     /**<Estimated current of dimmable LEDs, mA/255 */
+    uint32_t                limit_load_fix;     /**<Estimated current of ON/OFF LEDs, mA/255 */
+    bool                    limit_is_changed;   /**<Estimated current or brightness changed */
+#endif
+#if ( 1 == LED_CFG_STATS_EN )
+    led_stats_t             stats;              /**<Handler statistics */
+    uint64_t                stats_cycle_sum;    /**<Sum of handler execution cycles */
+#endif
+#if ( 1 == LED_CFG_TIMESTAMP_EN )
+    uint32_t                ts_now;             /**<Timestamp of current handler call */
+    uint32_t                ts_last;            /**<Timestamp of previous handler call */
+    #if ( 1 == LED_CFG_FIXED_POINT_EN )
+        uint64_t            ts_rem;             /**<Timestamp remainder of handler period */
+    #endif
+#endif
+#if ( 1 == LED_CFG_FIXED_POINT_EN )
+    float32_t               dt_rem;             /**<Elapsed time remainder of handler period */
+#endif
+#if ( 1 == LED_CFG_BULK_EN )
+    uint32_t                bulk_mask[ LED_MASK_NUM_OF ];                   /**<Staged LEDs bitmap */
+    uint32_t                bulk_state[ LED_MASK_NUM_OF ];                  /**<Staged LED states bitmap */
+    volatile bool           bulk_is_pending;    /**<Staged LED states waiting for handler */
+#endif
+#if ( 1 == LED_CFG_EVENT_EN )
+    uint8_t                 event_mask;         /**<Events subscribed for all LEDs, "led_event_t" bits */
+#endif
+    uint16_t                num_of;             /**<Number of LEDs */
+    bool                    is_init;            /**<Initialization guard */
+} led_ctx_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -87,13 +497,138 @@ led_status_t led_init           	(void);
 led_status_t led_deinit             (void);
 led_status_t led_is_init        	(bool * const p_is_init);
 led_status_t led_hndl           	(void);
+led_status_t led_hndl_elapsed       (const float32_t dt);
+led_status_t led_get_next_deadline  (float32_t * const p_time);
+led_status_t led_get_hndl_rate      (float32_t * const p_rate);
 led_status_t led_set            	(const led_num_t num, const led_state_t state);
 led_status_t led_toggle         	(const led_num_t num);
 led_status_t led_blink          	(const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
 led_status_t led_get_active_time	(const led_num_t num, float32_t * const p_active_time);
 led_status_t led_is_idle        	(const led_num_t num, bool * const p_is_idle);
 
-#if ( 1 == LED_CFG_TIMER_USE_EN )
+#if ( 1 == LED_CFG_SEQ_EN )
+    led_status_t led_sequence       (const led_num_t num, const led_seq_step_t * const p_seq);
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+    led_status_t led_ramp_to        (const led_num_t num, const float32_t duty, const float32_t time);
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+    led_status_t led_set_mask       (const uint32_t * const p_mask, const uint32_t * const p_state);
+    led_status_t led_set_many       (const led_num_t first, const led_state_t * const p_state, const uint16_t num_of);
+    led_status_t led_snapshot       (led_snapshot_t * const p_snap);
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+    led_status_t led_set_event_mask         (const led_num_t num, const uint8_t mask);
+    led_status_t led_set_event_mask_global  (const uint8_t mask);
+#endif
+
+led_status_t led_ctx_init               (led_ctx_t * const p_ctx, const led_cfg_t * const p_cfg, led_t * const p_led, const uint16_t num_of);
+led_status_t led_ctx_deinit             (led_ctx_t * const p_ctx);
+led_status_t led_ctx_is_init            (led_ctx_t * const p_ctx, bool * const p_is_init);
+led_status_t led_ctx_hndl               (led_ctx_t * const p_ctx);
+led_status_t led_ctx_hndl_elapsed       (led_ctx_t * const p_ctx, const float32_t dt);
+led_status_t led_ctx_get_next_deadline  (led_ctx_t * const p_ctx, float32_t * const p_time);
+led_status_t led_ctx_get_hndl_rate      (led_ctx_t * const p_ctx, float32_t * const p_rate);
+led_status_t led_ctx_set                (led_ctx_t * const p_ctx, const uint16_t num, const led_state_t state);
+led_status_t led_ctx_toggle             (led_ctx_t * const p_ctx, const uint16_t num);
+led_status_t led_ctx_blink              (led_ctx_t * const p_ctx, const uint16_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+led_status_t led_ctx_get_active_time    (led_ctx_t * const p_ctx, const uint16_t num, float32_t * const p_active_time);
+led_status_t led_ctx_is_idle            (led_ctx_t * const p_ctx, const uint16_t num, bool * const p_is_idle);
+
+#if ( 1 == LED_CFG_SEQ_EN )
+    led_status_t led_ctx_sequence       (led_ctx_t * const p_ctx, const uint16_t num, const led_seq_step_t * const p_seq);
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+    led_status_t led_ctx_ramp_to        (led_ctx_t * const p_ctx, const uint16_t num, const float32_t duty, const float32_t time);
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+    led_status_t led_ctx_set_mask       (led_ctx_t * const p_ctx, const uint32_t * const p_mask, const uint32_t * const p_state);
+    led_status_t led_ctx_set_many       (led_ctx_t * const p_ctx, const uint16_t first, const led_state_t * const p_state, const uint16_t num_of);
+    led_status_t led_ctx_snapshot       (led_ctx_t * const p_ctx, led_snapshot_t * const p_snap);
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+    led_status_t led_ctx_set_event_mask         (led_ctx_t * const p_ctx, const uint16_t num, const uint8_t mask);
+    led_status_t led_ctx_set_event_mask_global  (led_ctx_t * const p_ctx, const uint8_t mask);
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+    led_status_t led_ctx_set_brightness (led_ctx_t * const p_ctx, const float32_t brightness);
+    led_status_t led_ctx_get_brightness (led_ctx_t * const p_ctx, float32_t * const p_brightness);
+    led_status_t led_ctx_get_current    (led_ctx_t * const p_ctx, float32_t * const p_current);
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+    led_status_t led_ctx_get_stats      (led_ctx_t * const p_ctx, led_stats_t * const p_stats);
+    led_status_t led_ctx_reset_stats    (led_ctx_t * const p_ctx);
+#endif
+
+#if ( 1 == LED_PWM_USE_EN )
+    led_status_t led_ctx_set_smooth     (led_ctx_t * const p_ctx, const uint16_t num, const led_state_t state);
+    led_status_t led_ctx_blink_smooth   (led_ctx_t * const p_ctx, const uint16_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+    led_status_t led_ctx_set_fade_cfg   (led_ctx_t * const p_ctx, const uint16_t num, const led_fade_cfg_t * const p_fade_cfg);
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+    led_status_t led_cmd_set            (const led_num_t num, const led_state_t state);
+    led_status_t led_cmd_toggle         (const led_num_t num);
+    led_status_t led_cmd_blink          (const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+
+    #if ( 1 == LED_PWM_USE_EN )
+        led_status_t led_cmd_set_smooth     (const led_num_t num, const led_state_t state);
+        led_status_t led_cmd_blink_smooth   (const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
+    #endif
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+    led_status_t led_trace_read     (uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+    led_status_t led_group_add      (const led_group_t group, const led_num_t num);
+    led_status_t led_group_remove   (const led_group_t group, const led_num_t num);
+    led_status_t led_group_set      (const led_group_t group, const led_state_t state);
+    led_status_t led_group_blink    (const led_group_t group, const float32_t on_time, const float32_t period, const led_blink_t blink);
+
+    #if ( 1 == LED_PWM_USE_EN )
+        led_status_t led_group_set_smooth   (const led_group_t group, const led_state_t state);
+        led_status_t led_group_blink_smooth (const led_group_t group, const float32_t on_time, const float32_t period, const led_blink_t blink);
+    #endif
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+    led_status_t led_set_brightness (const float32_t brightness);
+    led_status_t led_get_brightness (float32_t * const p_brightness);
+    led_status_t led_get_current    (float32_t * const p_current);
+#endif
+
+#if ( 1 == LED_CFG_STATS_EN )
+    led_status_t led_get_stats      (led_stats_t * const p_stats);
+    led_status_t led_reset_stats    (void);
+#endif
+
+#if ( 1 == LED_CFG_FRAME_USE_EN )
+    void led_frame_tx_done (void);
+#endif
+
+#if ( 1 == LED_CFG_PIXEL_USE_EN )
+    void led_pixel_tx_done (void);
+#endif
+
+#if ( 1 == LED_CFG_BCM_USE_EN )
+    void led_bcm_isr (void);
+#endif
+
+#if ( 1 == LED_CFG_ASYNC_USE_EN )
+    void led_async_done (void);
+#endif
+
+#if ( 1 == LED_PWM_USE_EN )
     led_status_t led_set_smooth     (const led_num_t num, const led_state_t state);
     led_status_t led_blink_smooth   (const led_num_t num, const float32_t on_time, const float32_t period, const led_blink_t blink);
     led_status_t led_set_fade_cfg   (const led_num_t num, const led_fade_cfg_t * const p_fade_cfg);
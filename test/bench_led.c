@@ -0,0 +1,230 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     bench_led.c
+* @brief    Benchmark of LED handler
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @addtogroup BENCH_LED
+ * @{ <!-- BEGIN GROUP -->
+ *
+ *     Handler execution time is measured for mode mixes of all
+ *     LEDs. Same source is built for each LED count with float and
+ *     fixed point (no FPU) engine, LED count is set by
+ *     "BENCH_LED_NUM_OF" at end of LED enumeration.
+ *
+ *     Usage:
+ *         bench_led_<led_count>
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "led/src/led.h"
+#include "mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of LED handler calls before measurement
+ */
+#define BENCH_WARMUP_NUM_OF                     ( 100U )
+
+/**
+ *     Number of LED updates per measurement
+ *
+ * @note    Number of handler calls is scaled with LED count, so each
+ *          measurement takes similar time.
+ */
+#define BENCH_LED_UPD_NUM_OF                    ( 4000000UL )
+
+/**
+ *     Mode mix
+ */
+typedef enum
+{
+    eBENCH_MIX_STATIC = 0,  /**<All LEDs static ON */
+    eBENCH_MIX_BLINK,       /**<All LEDs blinking */
+    eBENCH_MIX_FADE,        /**<All LEDs fade blinking */
+    eBENCH_MIX_MIXED,       /**<Third of LEDs static, blinking and fade blinking */
+
+    eBENCH_MIX_NUM_OF
+} bench_mix_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void     bench_mode_start    (const led_num_t num, const bench_mix_t mix);
+static double   bench_run           (const bench_mix_t mix);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     LED configuration table
+ */
+static led_cfg_t g_led_cfg[ eLED_NUM_OF ] = { 0 };
+
+/**
+ *     Mode mix names
+ */
+static const char * const g_mix_name[ eBENCH_MIX_NUM_OF ] =
+{
+    [eBENCH_MIX_STATIC]     = "static",
+    [eBENCH_MIX_BLINK]      = "blink",
+    [eBENCH_MIX_FADE]       = "fade",
+    [eBENCH_MIX_MIXED]      = "mixed",
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start LED mode of mode mix
+*
+* @note     Blink periods are spread over LEDs, so LEDs change at
+*           different handler calls.
+*
+* @param[in]    num     - LED number
+* @param[in]    mix     - Mode mix
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_mode_start(const led_num_t num, const bench_mix_t mix)
+{
+    const uint32_t      mode    = ( eBENCH_MIX_MIXED == mix ) ? ( num % 3U ) : ((uint32_t) mix );
+    const float32_t     period  = ( 0.5f + 0.01f * (float32_t) ( num % 16U ));
+
+    switch( mode )
+    {
+        case eBENCH_MIX_BLINK:
+            (void) led_blink( num, ( 0.5f * period ), period, eLED_BLINK_CONTINUOUS );
+            break;
+
+        case eBENCH_MIX_FADE:
+            (void) led_blink_smooth( num, ( 0.5f * period ), period, eLED_BLINK_CONTINUOUS );
+            break;
+
+        case eBENCH_MIX_STATIC:
+        default:
+            (void) led_set( num, eLED_ON );
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Measure handler execution time
+*
+* @param[in]    mix     - Mode mix
+* @return       time    - Average handler execution time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double bench_run(const bench_mix_t mix)
+{
+    const uint32_t  call_num_of = ( BENCH_LED_UPD_NUM_OF / eLED_NUM_OF );
+    struct timespec start       = { 0 };
+    struct timespec stop        = { 0 };
+
+    (void) led_deinit();
+
+    if ( eLED_OK != led_init())
+    {
+        printf( "Init of %u LEDs failed!\n", (unsigned) eLED_NUM_OF );
+        return 0.0;
+    }
+
+    for ( uint32_t num = 0; num < eLED_NUM_OF; num++ )
+    {
+        bench_mode_start( (led_num_t) num, mix );
+    }
+
+    for ( uint32_t i = 0; i < BENCH_WARMUP_NUM_OF; i++ )
+    {
+        (void) led_hndl();
+    }
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &start );
+
+    for ( uint32_t i = 0; i < call_num_of; i++ )
+    {
+        (void) led_hndl();
+    }
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &stop );
+
+    return (( (double) ( stop.tv_sec - start.tv_sec ) * 1E9 + (double) ( stop.tv_nsec - start.tv_nsec )) / (double) call_num_of );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get LEDs configuration table
+*
+* @note     Timer PWM LEDs, so all modes can be mixed.
+*
+* @return        pointer to configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const led_cfg_t * led_cfg_get_table(void)
+{
+    for ( uint32_t num = 0; num < eLED_NUM_OF; num++ )
+    {
+        g_led_cfg[num].drv_type         = eLED_DRV_TIMER_PWM;
+        g_led_cfg[num].drv_ch.tim_ch    = (timer_ch_t) num;
+        g_led_cfg[num].initial_state    = eLED_OFF;
+        g_led_cfg[num].polarity         = eLED_POL_ACTIVE_HIGH;
+    }
+
+    return (led_cfg_t*) &g_led_cfg;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run benchmark over mode mixes
+*
+* @return       Zero
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    // Only latest driver values are kept
+    mock_rec_enable( false );
+
+    printf( "LED handler benchmark, %s engine\n", ( 1 == LED_CFG_FIXED_POINT_EN ) ? "fixed point" : "float" );
+    printf( "%-8s %6s %14s %12s\n", "mix", "leds", "ns/hndl", "ns/led" );
+
+    for ( uint32_t mix = 0; mix < eBENCH_MIX_NUM_OF; mix++ )
+    {
+        const double time = bench_run( (bench_mix_t) mix );
+
+        printf( "%-8s %6u %14.1f %12.2f\n", g_mix_name[mix], (unsigned) eLED_NUM_OF, time, ( time / (double) eLED_NUM_OF ));
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
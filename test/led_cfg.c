@@ -0,0 +1,80 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     led_cfg.c
+* @brief    LED configurations of host simulation
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @addtogroup LED_CFG
+ * @{ <!-- BEGIN GROUP -->
+ *
+ *     Default instance drives GPIO LED on pin 0 and timer PWM LED
+ *     on channel 0. Both are OFF after init, so whole waveform is
+ *     result of tested API calls.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "led_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Estimated LED current of limiter
+ *
+ *  Unit: mA
+ */
+#if ( 1 == LED_CFG_LIMIT_EN )
+    #define TEST_LED_CURRENT(ma)                .current_ma = ( ma ),
+#else
+    #define TEST_LED_CURRENT(ma)
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     LED configuration table
+ */
+static const led_cfg_t g_led_cfg[ eLED_NUM_OF ] =
+{
+    // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+    //                      Driver type                     LED driver channel          Initial State               Polarity                  Current
+    // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+    [eLED_STATUS]   =   { .drv_type = eLED_DRV_GPIO,        .drv_ch.gpio_pin = 0,       .initial_state = eLED_OFF,  .polarity = eLED_POL_ACTIVE_HIGH,   TEST_LED_CURRENT( 20 )     },
+    [eLED_ERR_COM]  =   { .drv_type = eLED_DRV_TIMER_PWM,   .drv_ch.tim_ch = 0,         .initial_state = eLED_OFF,  .polarity = eLED_POL_ACTIVE_HIGH,   TEST_LED_CURRENT( 20 )     },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get LEDs configuration table
+*
+* @return        pointer to configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const led_cfg_t * led_cfg_get_table(void)
+{
+    return (led_cfg_t*) &g_led_cfg;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,35 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     proj_cfg.h
+* @brief    Project configuration stub for host simulation
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJ_CFG_H
+#define __PROJ_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+
+// Mock hooks of generated LED configuration
+#include "mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Project assertion
+ */
+#define PROJ_CFG_ASSERT(x)                      assert(x)
+
+#endif // __PROJ_CFG_H
@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     gpio.h
+* @brief    GPIO driver stub for host simulation
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __GPIO_H
+#define __GPIO_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     GPIO status
+ */
+typedef enum
+{
+    eGPIO_OK    = 0x00U,    /**<Normal operation */
+    eGPIO_ERROR = 0x01U,    /**<General error code */
+} gpio_status_t;
+
+/**
+ *     GPIO pin, any pin number up to "MOCK_CH_NUM_OF"
+ */
+typedef uint16_t gpio_pin_t;
+
+/**
+ *     GPIO state
+ */
+typedef enum
+{
+    eGPIO_LOW = 0,  /**<Low GPIO state */
+    eGPIO_HIGH,     /**<High GPIO state */
+} gpio_state_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_is_init  (bool * const p_is_init);
+gpio_status_t gpio_set      (const gpio_pin_t pin, const gpio_state_t state);
+
+#endif // __GPIO_H
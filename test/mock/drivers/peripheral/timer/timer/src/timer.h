@@ -0,0 +1,48 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     timer.h
+* @brief    Timer driver stub for host simulation
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TIMER_H
+#define __TIMER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Timer status
+ */
+typedef enum
+{
+    eTIMER_OK       = 0x00U,    /**<Normal operation */
+    eTIMER_ERROR    = 0x01U,    /**<General error code */
+} timer_status_t;
+
+/**
+ *     Timer PWM channel, any channel number up to "MOCK_CH_NUM_OF"
+ */
+typedef uint16_t timer_ch_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+timer_status_t timer_is_init    (bool * const p_is_init);
+timer_status_t timer_pwm_set    (const timer_ch_t ch, const float duty);
+
+#endif // __TIMER_H
@@ -0,0 +1,32 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     cli.h
+* @brief    CLI stub for host simulation
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CLI_H
+#define __CLI_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Debug print goes to stderr, so it does not mix with traces
+ */
+#define cli_printf( ... )                       ( fprintf( stderr, __VA_ARGS__ ), fprintf( stderr, "\n" ))
+
+#endif // __CLI_H
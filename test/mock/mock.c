@@ -0,0 +1,370 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     mock.c
+* @brief    Recording GPIO and timer mock drivers
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @addtogroup MOCK
+ * @{ <!-- BEGIN GROUP -->
+ *
+ *     Each driver write is recorded together with handler tick, so
+ *     output waveform can be checked against golden trace.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+
+#include "mock.h"
+#include "drivers/peripheral/gpio/gpio/src/gpio.h"
+#include "drivers/peripheral/timer/timer/src/timer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Waveform record
+ */
+static mock_rec_t g_rec[ MOCK_REC_SIZE ] = { 0 };
+static uint32_t g_rec_num_of = 0U;
+
+/**
+ *     Callback record
+ */
+static mock_cb_t g_cb[ MOCK_CB_SIZE ] = { 0 };
+static uint32_t g_cb_num_of = 0U;
+
+/**
+ *     Number of timer phase offset writes
+ */
+static uint32_t g_phase_num_of = 0U;
+
+/**
+ *     Recording enable
+ */
+static bool gb_rec_en = true;
+
+/**
+ *     Current handler tick
+ */
+static uint32_t g_tick = 0U;
+
+/**
+ *     Latest written values
+ */
+static float g_value[2][ MOCK_CH_NUM_OF ] = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void mock_write(const mock_drv_t drv, const uint16_t ch, const float value);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Record driver write
+*
+* @param[in]    drv     - Written driver
+* @param[in]    ch      - GPIO pin or timer channel
+* @param[in]    value   - GPIO state or timer duty
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void mock_write(const mock_drv_t drv, const uint16_t ch, const float value)
+{
+    assert( ch < MOCK_CH_NUM_OF );
+
+    g_value[drv][ch] = value;
+
+    if  (   ( true == gb_rec_en )
+        &&  ( g_rec_num_of < MOCK_REC_SIZE ))
+    {
+        g_rec[g_rec_num_of].tick    = g_tick;
+        g_rec[g_rec_num_of].drv     = drv;
+        g_rec[g_rec_num_of].ch      = ch;
+        g_rec[g_rec_num_of].value   = value;
+        g_rec_num_of++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Clear record, latest values and tick
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_reset(void)
+{
+    g_rec_num_of    = 0U;
+    g_cb_num_of     = 0U;
+    g_phase_num_of  = 0U;
+    g_tick          = 0U;
+
+    for ( uint32_t ch = 0; ch < MOCK_CH_NUM_OF; ch++ )
+    {
+        g_value[ eMOCK_DRV_GPIO ][ch]   = 0.0f;
+        g_value[ eMOCK_DRV_TIMER ][ch]  = 0.0f;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Advance handler tick
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_tick(void)
+{
+    g_tick++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get handler tick
+*
+* @note     Used as monotonic timestamp of LED module.
+*
+* @return       tick    - Current handler tick
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t mock_tick_get(void)
+{
+    return g_tick;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Enable/Disable recording
+*
+* @note     Benchmark disables recording, so mock cost stays constant.
+*
+* @param[in]    is_enable   - Recording enable
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_rec_enable(const bool is_enable)
+{
+    gb_rec_en = is_enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Clear waveform and callback record
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_rec_clear(void)
+{
+    g_rec_num_of    = 0U;
+    g_cb_num_of     = 0U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get waveform record
+*
+* @param[out]   p_num_of    - Number of recorded writes
+* @return       p_rec       - Recorded writes
+*/
+////////////////////////////////////////////////////////////////////////////////
+const mock_rec_t * mock_rec_get(uint32_t * const p_num_of)
+{
+    *p_num_of = g_rec_num_of;
+
+    return g_rec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get latest written value
+*
+* @param[in]    drv     - Driver
+* @param[in]    ch      - GPIO pin or timer channel
+* @return       value   - GPIO state or timer duty
+*/
+////////////////////////////////////////////////////////////////////////////////
+float mock_value_get(const mock_drv_t drv, const uint16_t ch)
+{
+    assert( ch < MOCK_CH_NUM_OF );
+
+    return g_value[drv][ch];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Print waveform record in golden trace format
+*
+* @note     Line per write: tick, driver (G/T), channel, value.
+*
+* @param[in]    p_file  - Output file
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_rec_print(FILE * const p_file)
+{
+    for ( uint32_t i = 0; i < g_rec_num_of; i++ )
+    {
+        fprintf( p_file, "%u %c %u %.4f\n", (unsigned) g_rec[i].tick, ( eMOCK_DRV_GPIO == g_rec[i].drv ) ? 'G' : 'T', (unsigned) g_rec[i].ch, g_rec[i].value );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Mock GPIO driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_is_init(bool * const p_is_init)
+{
+    *p_is_init = true;
+
+    return eGPIO_OK;
+}
+
+gpio_status_t gpio_set(const gpio_pin_t pin, const gpio_state_t state)
+{
+    mock_write( eMOCK_DRV_GPIO, pin, ( eGPIO_HIGH == state ) ? ( 1.0f ) : ( 0.0f ));
+
+    return eGPIO_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Mock timer driver
+*/
+////////////////////////////////////////////////////////////////////////////////
+timer_status_t timer_is_init(bool * const p_is_init)
+{
+    *p_is_init = true;
+
+    return eTIMER_OK;
+}
+
+timer_status_t timer_pwm_set(const timer_ch_t ch, const float duty)
+{
+    mock_write( eMOCK_DRV_TIMER, ch, duty );
+
+    return eTIMER_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Mock timer DMA waveform start
+*
+* @note Whole waveform is recorded as timer writes at tick of DMA start.
+*
+* @param[in]    ch      - Timer channel
+* @param[in]    p_wave  - Waveform of timer compare values
+* @param[in]    size    - Number of waveform samples
+* @param[in]    period  - Timer compare value of full duty
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_dma_start(const uint16_t ch, const uint16_t * const p_wave, const uint32_t size, const uint32_t period)
+{
+    for ( uint32_t i = 0; i < size; i++ )
+    {
+        mock_write( eMOCK_DRV_TIMER, ch, ((float) p_wave[i] / (float) period ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Mock timer DMA waveform stop
+*
+* @note Compare register keeps its last value.
+*
+* @param[in]    ch      - Timer channel
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_dma_stop(const uint16_t ch)
+{
+    (void) ch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Record LED module callback
+*
+* @param[in]    num     - LED number
+* @param[in]    arg     - Callback argument
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_cb(const uint16_t num, const uint32_t arg)
+{
+    if ( g_cb_num_of < MOCK_CB_SIZE )
+    {
+        g_cb[g_cb_num_of].tick  = g_tick;
+        g_cb[g_cb_num_of].num   = num;
+        g_cb[g_cb_num_of].arg   = arg;
+        g_cb_num_of++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get callback record
+*
+* @param[out]   p_num_of    - Number of recorded callbacks
+* @return       p_cb        - Recorded callbacks
+*/
+////////////////////////////////////////////////////////////////////////////////
+const mock_cb_t * mock_cb_get(uint32_t * const p_num_of)
+{
+    *p_num_of = g_cb_num_of;
+
+    return &g_cb[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Count timer PWM channel phase offset write
+*
+* @param[in]    ch      - Timer channel
+* @param[in]    phase   - Phase offset in range [0, 1)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void mock_phase_set(const uint16_t ch, const float phase)
+{
+    assert( ch < MOCK_CH_NUM_OF );
+    assert(( phase >= 0.0f ) && ( phase < 1.0f ));
+
+    g_phase_num_of++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of timer phase offset writes since reset
+*
+* @return       num_of  - Number of phase offset writes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t mock_phase_cnt(void)
+{
+    return g_phase_num_of;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
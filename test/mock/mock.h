@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     mock.h
+* @brief    Recording GPIO and timer mock drivers
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __MOCK_H
+#define __MOCK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of GPIO pins and timer channels
+ */
+#define MOCK_CH_NUM_OF                          ( 1024U )
+
+/**
+ *     Size of waveform record
+ *
+ *  Unit: driver write
+ */
+#define MOCK_REC_SIZE                           ( 8192U )
+
+/**
+ *     Size of callback record
+ *
+ *  Unit: callback
+ */
+#define MOCK_CB_SIZE                            ( 64U )
+
+/**
+ *     Mocked low level driver
+ */
+typedef enum
+{
+    eMOCK_DRV_GPIO = 0,     /**<GPIO driver */
+    eMOCK_DRV_TIMER,        /**<Timer PWM driver */
+} mock_drv_t;
+
+/**
+ *     Recorded driver write
+ */
+typedef struct
+{
+    uint32_t    tick;       /**<Handler tick of write */
+    mock_drv_t  drv;        /**<Written driver */
+    uint16_t    ch;         /**<GPIO pin or timer channel */
+    float       value;      /**<GPIO state or timer duty */
+} mock_rec_t;
+
+/**
+ *     Recorded LED module callback
+ */
+typedef struct
+{
+    uint32_t    tick;       /**<Handler tick of callback */
+    uint16_t    num;        /**<LED number */
+    uint32_t    arg;        /**<Callback argument */
+} mock_cb_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void                mock_reset      (void);
+void                mock_tick       (void);
+uint32_t            mock_tick_get   (void);
+void                mock_rec_enable (const bool is_enable);
+void                mock_rec_clear  (void);
+const mock_rec_t *  mock_rec_get    (uint32_t * const p_num_of);
+float               mock_value_get  (const mock_drv_t drv, const uint16_t ch);
+void                mock_rec_print  (FILE * const p_file);
+void                mock_dma_start  (const uint16_t ch, const uint16_t * const p_wave, const uint32_t size, const uint32_t period);
+void                mock_dma_stop   (const uint16_t ch);
+void                mock_cb         (const uint16_t num, const uint32_t arg);
+const mock_cb_t *   mock_cb_get     (uint32_t * const p_num_of);
+void                mock_phase_set  (const uint16_t ch, const float phase);
+uint32_t            mock_phase_cnt  (void);
+
+#endif // __MOCK_H
@@ -0,0 +1,1826 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_led.c
+* @brief    Golden trace regression checks of LED handler
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     14.10.2026
+* @version  V1.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @addtogroup TEST_LED
+ * @{ <!-- BEGIN GROUP -->
+ *
+ *     Each test runs LED API scenario with handler called once per
+ *     tick and records output waveform with mock drivers. Waveform
+ *     is checked for expected edge timing or fading shape and
+ *     compared against golden trace.
+ *
+ *     Usage:
+ *         test_led <golden_dir>       - Run checks
+ *         test_led <golden_dir> -u    - Re-generate golden traces
+ *         test_led -                  - Run checks without golden traces
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "led/src/led.h"
+#include "mock.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Allowed difference of timer duty against golden trace
+ *
+ * @note    Covers float rounding differences between host compilers.
+ */
+#define TEST_DUTY_TOL                           ( 1E-3f )
+
+/**
+ *     Blink timings
+ *
+ *  Unit: handler tick
+ */
+#define TEST_BLINK_ON_TICK                      ( 10U )
+#define TEST_BLINK_PERIOD_TICK                  ( 50U )
+#define TEST_BLINK_NUM_OF                       ( 3U )
+
+/**
+ *     Tolerance of timer PWM edge timing
+ *
+ * @note    With phase staggered updates timer channel is written only in
+ *          its phase slot.
+ *
+ *  Unit: handler tick
+ */
+#if ( 1 == LED_CFG_PHASE_EN )
+    #define TEST_TIMER_TICK_TOL                 ( LED_CFG_PHASE_SLOT_NUM_OF - 1U )
+#else
+    #define TEST_TIMER_TICK_TOL                 ( 0U )
+#endif
+
+/**
+ *     Number of blinks of blink count test
+ */
+#define TEST_BLINK_CNT_NUM_OF                   ( 5U )
+
+/**
+ *     Number of fade blinks
+ */
+#define TEST_FADE_BLINK_NUM_OF                  ( 2U )
+
+/**
+ *     Default fade time of group
+ *
+ *  Unit: handler tick
+ */
+#define TEST_GROUP_FADE_TICK                    ( 100U )
+
+/**
+ *     Sequence pulse timing and loop repeats
+ *
+ *  Unit: handler tick
+ */
+#define TEST_SEQ_PULSE_TICK                     ( 5U )
+#define TEST_SEQ_INNER_REPEAT                   ( 2U )
+#define TEST_SEQ_OUTER_REPEAT                   ( 1U )
+
+/**
+ *     Global brightness of limiter test
+ */
+#define TEST_LIMIT_BRIGHTNESS                   ( 0.5f )
+
+/**
+ *     Number of timer duty steps of limiter test
+ */
+#define TEST_LIMIT_STEP_NUM_OF                  ( 5U )
+
+/**
+ *     Ramp target and time, and retarget after half of ramp
+ *
+ *  Unit: duty and handler tick
+ */
+#define TEST_RAMP_DUTY                          ( 0.6f )
+#define TEST_RAMP_TICK                          ( 50U )
+#define TEST_RAMP_RE_DUTY                       ( 0.2f )
+#define TEST_RAMP_RE_TICK                       ( 20U )
+
+/**
+ *     Time between blink start and first handler call
+ *
+ *  Unit: sec
+ */
+#define TEST_GAP_S                              ( 10.0f )
+
+/**
+ *     Number of blinks after handler gap
+ */
+#define TEST_GAP_BLINK_NUM_OF                   ( 2U )
+
+/**
+ *     Maximum number of handler calls of tickless test
+ */
+#define TEST_TICKLESS_CALL_NUM_OF               ( 100U )
+
+/**
+ *     Number of LEDs of additional instance
+ */
+#define TEST_CTX_LED_NUM_OF                     ( 2U )
+
+/**
+ *     Additional LED instance available
+ *
+ * @note    Groups, command queue, timer DMA waveforms, trace and phase
+ *          slots belong to default instance only, additional instance
+ *          fails to initialize when any is enabled.
+ */
+#if (( 0 == LED_CFG_GROUP_EN ) && ( 0 == LED_CFG_CMD_QUEUE_EN ) && ( 0 == LED_CFG_TIMER_DMA_EN ) && ( 0 == LED_CFG_TRACE_EN ) && ( 0 == LED_CFG_PHASE_EN ))
+    #define TEST_CTX_EN                         ( 1 )
+#else
+    #define TEST_CTX_EN                         ( 0 )
+#endif
+
+/**
+ *     Golden directory argument of run without golden traces
+ */
+#define TEST_GOLDEN_NONE                        "-"
+
+/**
+ *     Test case
+ */
+typedef struct
+{
+    const char * name;                                          /**<Name and golden trace file */
+    void (*pf_run)(void);                                       /**<Scenario */
+    bool (*pf_check)(const mock_rec_t * const p_rec, const uint32_t num_of);   /**<Waveform check */
+} test_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void test_hndl               (const uint32_t tick_num_of);
+static void test_hndl_tickless      (void);
+static const mock_rec_t * test_edges(const mock_rec_t * const p_rec, const uint32_t num_of, const mock_drv_t drv, uint32_t * const p_edge_num_of);
+static bool test_blink_edges        (const mock_rec_t * const p_rec, const uint32_t num_of, const mock_drv_t drv, const uint32_t blink_num_of);
+static void test_blink_run          (void);
+static bool test_blink_check        (const mock_rec_t * const p_rec, const uint32_t num_of);
+static void test_tickless_run       (void);
+static void test_gap_run            (void);
+static bool test_gap_check          (const mock_rec_t * const p_rec, const uint32_t num_of);
+static void test_fade_run           (void);
+static bool test_fade_check         (const mock_rec_t * const p_rec, const uint32_t num_of);
+static void test_fade_blink_run     (void);
+static bool test_fade_blink_check   (const mock_rec_t * const p_rec, const uint32_t num_of);
+static bool test_fade_shape         (const mock_rec_t * const p_rec, const uint32_t num_of, const uint32_t rise_num_of);
+
+#if ( 1 == TEST_CTX_EN )
+    static void test_ctx_run            (void);
+    static bool test_ctx_check          (const mock_rec_t * const p_rec, const uint32_t num_of);
+    static void test_ctx_pol_run        (void);
+    static bool test_ctx_pol_check      (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_PHASE_EN )
+    static void test_phase_run          (void);
+    static bool test_phase_check        (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+    static void test_trace_run          (void);
+    static bool test_trace_check        (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+    static void test_event_run          (void);
+    static bool test_event_check        (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_SEQ_EN )
+    static void test_seq_run            (void);
+    static bool test_seq_check          (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+    static void test_cmd_run            (void);
+    static bool test_cmd_check          (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+    static void test_limit_run          (void);
+    static bool test_limit_check        (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+    static void test_ramp_run           (void);
+    static bool test_ramp_check         (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+    static void test_bulk_run           (void);
+    static bool test_bulk_check         (const mock_rec_t * const p_rec, const uint32_t num_of);
+    static void test_bulk_override_run  (void);
+    static bool test_bulk_override_check(const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+    static void test_group_blink_run    (void);
+    static bool test_group_blink_check  (const mock_rec_t * const p_rec, const uint32_t num_of);
+    static void test_group_fade_run     (void);
+#endif
+
+#if (( 1 == LED_CFG_GROUP_EN ) && ( 1 == LED_CFG_EVENT_EN ))
+    static void test_group_event_run    (void);
+    static bool test_group_event_check  (const mock_rec_t * const p_rec, const uint32_t num_of);
+#endif
+
+static bool test_golden_cmp         (const char * const p_path, const mock_rec_t * const p_rec, const uint32_t num_of);
+static bool test_golden_write       (const char * const p_path);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == TEST_CTX_EN )
+
+    /**
+     *     Additional LED instance
+     */
+    static const led_cfg_t g_ctx_cfg[ TEST_CTX_LED_NUM_OF ] =
+    {
+        { .drv_type = eLED_DRV_GPIO,        .drv_ch.gpio_pin = 1,       .initial_state = eLED_OFF,  .polarity = eLED_POL_ACTIVE_HIGH    },
+        { .drv_type = eLED_DRV_TIMER_PWM,   .drv_ch.tim_ch = 1,         .initial_state = eLED_OFF,  .polarity = eLED_POL_ACTIVE_HIGH    },
+    };
+
+    /**
+     *     Additional LED instance with active low LEDs
+     */
+    static const led_cfg_t g_ctx_pol_cfg[ TEST_CTX_LED_NUM_OF ] =
+    {
+        { .drv_type = eLED_DRV_GPIO,        .drv_ch.gpio_pin = 1,       .initial_state = eLED_OFF,  .polarity = eLED_POL_ACTIVE_LOW     },
+        { .drv_type = eLED_DRV_TIMER_PWM,   .drv_ch.tim_ch = 1,         .initial_state = eLED_OFF,  .polarity = eLED_POL_ACTIVE_LOW     },
+    };
+
+    static led_t        g_ctx_led[ TEST_CTX_LED_NUM_OF ];
+    static led_ctx_t    g_ctx;
+    static led_status_t g_ctx_status = eLED_OK;
+
+#endif
+
+#if ( 1 == LED_CFG_PHASE_EN )
+
+    /**
+     *     Phase slots are re-assigned by handler after group change
+     */
+    static bool g_phase_is_deferred = true;
+
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+
+    /**
+     *     Drained output trace
+     */
+    static uint8_t  g_trace[ LED_CFG_TRACE_SIZE ];
+    static uint32_t g_trace_len = 0U;
+
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+
+    /**
+     *     Snapshots of bulk test, before and after handler call
+     */
+    static led_snapshot_t g_bulk_snap[2];
+
+#endif
+
+/**
+ *     Test cases
+ */
+static const test_t g_test[] =
+{
+    { .name = "blink",          .pf_run = test_blink_run,       .pf_check = test_blink_check        },
+    { .name = "fade",           .pf_run = test_fade_run,        .pf_check = test_fade_check         },
+    { .name = "fade_blink",     .pf_run = test_fade_blink_run,  .pf_check = test_fade_blink_check   },
+    { .name = "tickless",       .pf_run = test_tickless_run,    .pf_check = test_blink_check        },
+    { .name = "gap",            .pf_run = test_gap_run,         .pf_check = test_gap_check          },
+
+#if ( 1 == TEST_CTX_EN )
+    { .name = "ctx",            .pf_run = test_ctx_run,         .pf_check = test_ctx_check          },
+    { .name = "ctx_pol",        .pf_run = test_ctx_pol_run,     .pf_check = test_ctx_pol_check      },
+#endif
+
+#if ( 1 == LED_CFG_PHASE_EN )
+    { .name = "phase",          .pf_run = test_phase_run,       .pf_check = test_phase_check        },
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+    { .name = "trace",          .pf_run = test_trace_run,       .pf_check = test_trace_check        },
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+    { .name = "event",          .pf_run = test_event_run,       .pf_check = test_event_check        },
+#endif
+
+#if ( 1 == LED_CFG_SEQ_EN )
+    { .name = "seq",            .pf_run = test_seq_run,         .pf_check = test_seq_check          },
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+    { .name = "cmd",            .pf_run = test_cmd_run,         .pf_check = test_cmd_check          },
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+    { .name = "limit",          .pf_run = test_limit_run,       .pf_check = test_limit_check        },
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+    { .name = "ramp",           .pf_run = test_ramp_run,        .pf_check = test_ramp_check         },
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+    { .name = "bulk",           .pf_run = test_bulk_run,            .pf_check = test_bulk_check             },
+    { .name = "bulk_override",  .pf_run = test_bulk_override_run,   .pf_check = test_bulk_override_check    },
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+    { .name = "group_blink",    .pf_run = test_group_blink_run, .pf_check = test_group_blink_check  },
+    { .name = "group_fade",     .pf_run = test_group_fade_run,  .pf_check = test_fade_check         },
+#endif
+
+#if (( 1 == LED_CFG_GROUP_EN ) && ( 1 == LED_CFG_EVENT_EN ))
+    { .name = "group_event",    .pf_run = test_group_event_run, .pf_check = test_group_event_check  },
+#endif
+};
+
+#if ( 1 == LED_CFG_SEQ_EN )
+
+    /**
+     *     Nested loop sequence: pulses in inner loop followed by ramp
+     *     to half duty in outer loop
+     */
+    static const led_seq_step_t g_seq[] =
+    {
+        LED_SEQ_SET( 255U, TEST_SEQ_PULSE_TICK ),
+        LED_SEQ_SET( 0U, TEST_SEQ_PULSE_TICK ),
+        LED_SEQ_JUMP( 0U, TEST_SEQ_INNER_REPEAT ),
+        LED_SEQ_LINEAR( 128U, 10U ),
+        LED_SEQ_SET( 0U, TEST_SEQ_PULSE_TICK ),
+        LED_SEQ_JUMP( 0U, TEST_SEQ_OUTER_REPEAT ),
+        LED_SEQ_END(),
+    };
+
+#endif
+
+/**
+ *     Recorded writes that change driver value
+ */
+static mock_rec_t g_edge[ MOCK_REC_SIZE ] = { 0 };
+
+/**
+ *     Fading configuration of timer PWM LED
+ */
+static const led_fade_cfg_t g_fade_cfg =
+{
+    .fade_in_time   = 0.3f,
+    .fade_out_time  = 0.3f,
+    .max_duty       = 1.0f,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call LED handler for number of ticks
+*
+* @param[in]    tick_num_of - Number of handler ticks
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_hndl(const uint32_t tick_num_of)
+{
+    for ( uint32_t tick = 0; tick < tick_num_of; tick++ )
+    {
+        (void) led_hndl();
+        mock_tick();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call LED handler only at its next deadline
+*
+* @note     Handler tick is advanced by deadline, so waveform is
+*           comparable with periodically called handler.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_hndl_tickless(void)
+{
+    float32_t deadline = 0.0f;
+
+    for ( uint32_t call = 0; call < TEST_TICKLESS_CALL_NUM_OF; call++ )
+    {
+        (void) led_get_next_deadline( &deadline );
+
+        if ( deadline >= LED_DEADLINE_NONE_S )
+        {
+            break;
+        }
+
+        for ( uint32_t tick = 0; tick < (uint32_t) lroundf( deadline / LED_CFG_HNDL_PERIOD_S ); tick++ )
+        {
+            mock_tick();
+        }
+
+        (void) led_hndl_elapsed( deadline );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get recorded writes of driver that change driver value
+*
+* @note     Options may rewrite unchanged value (e.g. LED refresh),
+*           edge checks are therefore done on value changes only.
+*           All channels are zero at start of record.
+*
+* @param[in]    p_rec           - Recorded writes
+* @param[in]    num_of          - Number of recorded writes
+* @param[in]    drv             - Checked driver
+* @param[out]   p_edge_num_of   - Number of value changes
+* @return       p_edge          - Value changes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static const mock_rec_t * test_edges(const mock_rec_t * const p_rec, const uint32_t num_of, const mock_drv_t drv, uint32_t * const p_edge_num_of)
+{
+    uint32_t edge_num_of = 0U;
+
+    for ( uint32_t i = 0; i < num_of; i++ )
+    {
+        bool is_change = ( 0.0f != p_rec[i].value );
+
+        // Find previous write to same channel
+        for ( uint32_t prev = i; prev > 0U; prev-- )
+        {
+            if  (   ( p_rec[ prev - 1U ].drv == p_rec[i].drv )
+                &&  ( p_rec[ prev - 1U ].ch == p_rec[i].ch ))
+            {
+                is_change = ( p_rec[ prev - 1U ].value != p_rec[i].value );
+                break;
+            }
+        }
+
+        if  (   ( drv == p_rec[i].drv )
+            &&  ( true == is_change ))
+        {
+            g_edge[ edge_num_of ] = p_rec[i];
+            edge_num_of++;
+        }
+    }
+
+    *p_edge_num_of = edge_num_of;
+
+    return g_edge;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check blink edges of driver
+*
+* @brief    Each blink shall be ON for exactly "TEST_BLINK_ON_TICK" and
+*           blinks shall follow each other in "TEST_BLINK_PERIOD_TICK".
+*
+* @param[in]    p_rec           - Recorded writes
+* @param[in]    num_of          - Number of recorded writes
+* @param[in]    drv             - Checked driver
+* @param[in]    blink_num_of    - Expected number of blinks
+* @return       is_ok           - Waveform is as expected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_blink_edges(const mock_rec_t * const p_rec, const uint32_t num_of, const mock_drv_t drv, const uint32_t blink_num_of)
+{
+    uint32_t            edge_num_of = 0U;
+    const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, drv, &edge_num_of );
+    const uint32_t      tol         = ( eMOCK_DRV_TIMER == drv ) ? ( TEST_TIMER_TICK_TOL ) : ( 0U );
+    bool                is_ok       = (( 2U * blink_num_of ) == edge_num_of );
+
+    for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+    {
+        const uint32_t blink    = ( i / 2U );
+        const bool     is_on    = ( 0U == ( i % 2U ));
+        const uint32_t tick     = ( p_edge[0].tick + ( blink * TEST_BLINK_PERIOD_TICK ) + (( true == is_on ) ? ( 0U ) : ( TEST_BLINK_ON_TICK )));
+
+        if  (   (( tick + tol ) < p_edge[i].tick )
+            ||  ( tick > ( p_edge[i].tick + tol ))
+            ||  ( (( true == is_on ) ? ( 1.0f ) : ( 0.0f )) != p_edge[i].value ))
+        {
+            printf( "  edge %u at tick %u with value %.0f, expected tick %u\n", (unsigned) i, (unsigned) p_edge[i].tick, p_edge[i].value, (unsigned) tick );
+            is_ok = false;
+        }
+    }
+
+    if ( ( 2U * blink_num_of ) != edge_num_of )
+    {
+        printf( "  %u edges, expected %u\n", (unsigned) edge_num_of, (unsigned) ( 2U * blink_num_of ));
+    }
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Finite blinking of GPIO LED
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_blink_run(void)
+{
+    (void) led_blink( eLED_STATUS, 0.1f, 0.5f, eLED_BLINK_3X );
+    test_hndl( 200U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check finite blinking
+*
+* @param[in]    p_rec   - Recorded writes
+* @param[in]    num_of  - Number of recorded writes
+* @return       is_ok   - Waveform is as expected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_blink_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+{
+    return test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_BLINK_NUM_OF );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Finite blinking of GPIO LED with tickless handler
+*
+* @note     Handler is called right after blink start, as tickless
+*           application wakes up on LED API call.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_tickless_run(void)
+{
+    (void) led_blink( eLED_STATUS, 0.1f, 0.5f, eLED_BLINK_3X );
+    (void) led_hndl_elapsed( 0.0f );
+    test_hndl_tickless();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Blinking started long before first handler call
+*
+* @brief    Time before first handler call shall not be counted, so
+*           blinking starts with full ON time at first handler call.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_gap_run(void)
+{
+    (void) led_blink( eLED_STATUS, 0.1f, 0.5f, eLED_BLINK_CONTINUOUS );
+    (void) led_hndl_elapsed( TEST_GAP_S );
+    mock_tick();
+
+    test_hndl(( TEST_GAP_BLINK_NUM_OF * TEST_BLINK_PERIOD_TICK ) - 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check blinking after handler gap
+*
+* @param[in]    p_rec   - Recorded writes
+* @param[in]    num_of  - Number of recorded writes
+* @return       is_ok   - Waveform is as expected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_gap_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+{
+    uint32_t            edge_num_of = 0U;
+    const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+    bool                is_ok       = test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_GAP_BLINK_NUM_OF );
+
+    if  (   ( true == is_ok )
+        &&  ( 0U != p_edge[0].tick ))
+    {
+        printf( "  first edge at tick %u, expected at gap\n", (unsigned) p_edge[0].tick );
+        is_ok = false;
+    }
+
+    return is_ok;
+}
+
+#if ( 1 == TEST_CTX_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Blinking of GPIO LED of additional instance
+    *
+    * @note     Instance drives GPIO pin and timer channel next to ones of
+    *           default instance.
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_ctx_run(void)
+    {
+        g_ctx_status = led_ctx_init( &g_ctx, &g_ctx_cfg[0], &g_ctx_led[0], TEST_CTX_LED_NUM_OF );
+
+        if ( eLED_OK == g_ctx_status )
+        {
+            (void) led_ctx_blink( &g_ctx, 0U, 0.1f, 0.5f, eLED_BLINK_3X );
+
+            for ( uint32_t tick = 0; tick < 200U; tick++ )
+            {
+                (void) led_hndl();
+                (void) led_ctx_hndl( &g_ctx );
+                mock_tick();
+            }
+
+            (void) led_ctx_deinit( &g_ctx );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check additional instance
+    *
+    * @brief    GPIO LED of instance shall blink as with default instance,
+    *           while LEDs of default instance stay OFF.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_ctx_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+        bool                is_ok       = ( eLED_OK == g_ctx_status );
+
+        is_ok = is_ok && test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_BLINK_NUM_OF );
+
+        for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+        {
+            if ( g_ctx_cfg[0].drv_ch.gpio_pin != p_edge[i].ch )
+            {
+                printf( "  LED of default instance changed\n" );
+                is_ok = false;
+            }
+        }
+
+        (void) test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+
+        if ( 0U != edge_num_of )
+        {
+            printf( "  timer PWM LED changed\n" );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Blinking of active low GPIO LED of additional instance
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_ctx_pol_run(void)
+    {
+        g_ctx_status = led_ctx_init( &g_ctx, &g_ctx_pol_cfg[0], &g_ctx_led[0], TEST_CTX_LED_NUM_OF );
+
+        if ( eLED_OK == g_ctx_status )
+        {
+            (void) led_ctx_blink( &g_ctx, 0U, 0.1f, 0.5f, eLED_BLINK_3X );
+
+            for ( uint32_t tick = 0; tick < 200U; tick++ )
+            {
+                (void) led_ctx_hndl( &g_ctx );
+                mock_tick();
+            }
+
+            (void) led_ctx_deinit( &g_ctx );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check polarity of additional instance
+    *
+    * @brief    Active low LEDs shall be driven high at init when OFF and
+    *           GPIO LED shall then blink with inverted levels, while timer
+    *           PWM LED stays at full duty.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_ctx_pol_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+        bool                is_ok       = ( eLED_OK == g_ctx_status );
+
+        // OFF at init followed by ON and OFF of each blink
+        if ( ( 1U + ( 2U * TEST_BLINK_NUM_OF )) != edge_num_of )
+        {
+            printf( "  %u GPIO edges, expected %u\n", (unsigned) edge_num_of, (unsigned) ( 1U + ( 2U * TEST_BLINK_NUM_OF )));
+            is_ok = false;
+        }
+
+        for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+        {
+            if ( (( 0U == ( i % 2U )) ? ( 1.0f ) : ( 0.0f )) != p_edge[i].value )
+            {
+                printf( "  GPIO edge %u at tick %u with value %.0f, expected inverted level\n", (unsigned) i, (unsigned) p_edge[i].tick, p_edge[i].value );
+                is_ok = false;
+            }
+        }
+
+        p_edge = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+
+        if  (   ( true == is_ok )
+            &&  (   ( 1U != edge_num_of )
+                ||  ( 1.0f != p_edge[0].value )))
+        {
+            printf( "  %u timer edges, expected single edge to full duty\n", (unsigned) edge_num_of );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Fade in and out of timer PWM LED
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fade_run(void)
+{
+    (void) led_set_fade_cfg( eLED_ERR_COM, &g_fade_cfg );
+
+    (void) led_set_smooth( eLED_ERR_COM, eLED_ON );
+    test_hndl( 50U );
+
+    (void) led_set_smooth( eLED_ERR_COM, eLED_OFF );
+    test_hndl( 50U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check fade in and out
+*
+* @param[in]    p_rec   - Recorded writes
+* @param[in]    num_of  - Number of recorded writes
+* @return       is_ok   - Waveform is as expected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_fade_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+{
+    return test_fade_shape( p_rec, num_of, 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Finite fade blinking of timer PWM LED
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fade_blink_run(void)
+{
+    (void) led_set_fade_cfg( eLED_ERR_COM, &g_fade_cfg );
+
+    (void) led_blink_smooth( eLED_ERR_COM, 0.4f, 1.0f, eLED_BLINK_2X);
+    test_hndl( 250U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check fade blinking
+*
+* @param[in]    p_rec   - Recorded writes
+* @param[in]    num_of  - Number of recorded writes
+* @return       is_ok   - Waveform is as expected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_fade_blink_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+{
+    return test_fade_shape( p_rec, num_of, TEST_FADE_BLINK_NUM_OF );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check fading monotonicity of timer PWM LED
+*
+* @brief    Duty shall only rise during fade in and only fall during
+*           fade out, so waveform shall consist of expected number of
+*           rising and falling runs. Fading shall reach full duty and
+*           end fully OFF.
+*
+* @param[in]    p_rec       - Recorded writes
+* @param[in]    num_of      - Number of recorded writes
+* @param[in]    rise_num_of - Expected number of fade ins
+* @return       is_ok       - Waveform is as expected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_fade_shape(const mock_rec_t * const p_rec, const uint32_t num_of, const uint32_t rise_num_of)
+{
+    uint32_t            edge_num_of = 0U;
+    const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+    bool                is_ok       = ( edge_num_of > 0U );
+    uint32_t            rise_cnt    = 0U;
+    uint32_t            fall_cnt    = 0U;
+    int32_t             dir         = 0;
+    float               prev        = 0.0f;
+    float               peak        = 0.0f;
+
+    for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+    {
+        // Start of rising run
+        if (( p_edge[i].value > prev ) && ( dir <= 0 ))
+        {
+            dir = 1;
+            rise_cnt++;
+        }
+
+        // Start of falling run
+        else if (( p_edge[i].value < prev ) && ( dir >= 0 ))
+        {
+            // Fall shall start from full duty
+            if ( peak < g_fade_cfg.max_duty )
+            {
+                printf( "  fall from %.4f at tick %u\n", peak, (unsigned) p_edge[i].tick );
+                is_ok = false;
+            }
+
+            dir = -1;
+            fall_cnt++;
+        }
+        else
+        {
+            // Same run...
+        }
+
+        peak = ( p_edge[i].value > peak ) ? ( p_edge[i].value ) : ( peak );
+        peak = ( dir < 0 ) ? ( 0.0f ) : ( peak );
+        prev = p_edge[i].value;
+    }
+
+    if  (   ( rise_num_of != rise_cnt )
+        ||  ( rise_num_of != fall_cnt ))
+    {
+        printf( "  %u rising and %u falling runs, expected %u\n", (unsigned) rise_cnt, (unsigned) fall_cnt, (unsigned) rise_num_of );
+        is_ok = false;
+    }
+
+    if  (   ( edge_num_of > 0U )
+        &&  ( 0.0f != p_edge[ edge_num_of - 1U ].value ))
+    {
+        printf( "  ends at %.4f\n", p_edge[ edge_num_of - 1U ].value );
+        is_ok = false;
+    }
+
+    return is_ok;
+}
+
+#if ( 1 == LED_CFG_PHASE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Fade in and out of timer PWM LED with phase staggered updates
+    *
+    * @note     With groups LED is added to group first, phase slots shall
+    *           not be re-assigned before next handler call.
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_phase_run(void)
+    {
+        #if ( 1 == LED_CFG_GROUP_EN )
+
+            const uint32_t phase_cnt = mock_phase_cnt();
+
+            (void) led_group_add( eLED_GROUP_ALL, eLED_ERR_COM );
+            g_phase_is_deferred = ( phase_cnt == mock_phase_cnt());
+
+            (void) led_hndl();
+            mock_tick();
+            g_phase_is_deferred = (( true == g_phase_is_deferred ) && ( phase_cnt < mock_phase_cnt()));
+
+        #endif
+
+        test_fade_run();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check phase staggered updates
+    *
+    * @brief    Fade shall keep its shape, while timer channel is written
+    *           only in its slot, that is every "LED_CFG_PHASE_SLOT_NUM_OF"
+    *           handler call, unless fade is streamed by timer DMA.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_phase_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+        bool                is_ok       = test_fade_check( p_rec, num_of );
+
+        if ( false == g_phase_is_deferred )
+        {
+            printf( "  phase slots not re-assigned by handler call\n" );
+            is_ok = false;
+        }
+
+        // Fading streamed by timer DMA is not staggered
+        for ( uint32_t i = 1; ( i < edge_num_of ) && ( true == is_ok ) && ( 0 == LED_CFG_TIMER_DMA_EN ); i++ )
+        {
+            if ( 0U != (( p_edge[i].tick - p_edge[0].tick ) % LED_CFG_PHASE_SLOT_NUM_OF ))
+            {
+                printf( "  timer written at tick %u outside of its slot\n", (unsigned) p_edge[i].tick );
+                is_ok = false;
+            }
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_TRACE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Finite blinking of GPIO LED with drained output trace
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_trace_run(void)
+    {
+        g_trace_len = 0U;
+
+        (void) led_blink( eLED_STATUS, 0.1f, 0.5f, eLED_BLINK_3X );
+        test_hndl( 200U );
+
+        (void) led_trace_read( &g_trace[0], sizeof( g_trace ), &g_trace_len );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check output trace
+    *
+    * @brief    Decoded trace of GPIO LED shall contain same level changes
+    *           as recorded GPIO writes, spaced by same number of ticks.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_trace_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+        bool                is_ok       = test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_BLINK_NUM_OF );
+        uint32_t            pos         = 0U;
+        uint32_t            tick        = 0U;
+        uint32_t            tick_first  = 0U;
+        uint32_t            change      = 0U;
+        uint16_t            duty_prev   = 0U;
+
+        while (( pos < g_trace_len ) && ( true == is_ok ))
+        {
+            uint32_t field[2] = { 0U, 0U };
+
+            // Tick delta and LED number as varint
+            for ( uint32_t f = 0; f < 2U; f++ )
+            {
+                for ( uint32_t shift = 0U; pos < g_trace_len; shift += 7U )
+                {
+                    const uint8_t byte = g_trace[ pos++ ];
+
+                    field[f] |= ((uint32_t) ( byte & 0x7FU ) << shift );
+
+                    if ( 0U == ( byte & 0x80U ))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            const uint16_t duty = (uint16_t) ( g_trace[pos] | ( g_trace[ pos + 1U ] << 8U ));
+            pos  += 2U;
+            tick += field[0];
+
+            if  (   ( eLED_STATUS == field[1] )
+                &&  ( duty != duty_prev ))
+            {
+                tick_first = ( 0U == change ) ? ( tick ) : ( tick_first );
+
+                if  (   ( change >= edge_num_of )
+                    ||  ( (( 1.0f == p_edge[change].value ) ? ( 0xFFFFU ) : ( 0U )) != duty )
+                    ||  ( ( tick - tick_first ) != ( p_edge[change].tick - p_edge[0].tick )))
+                {
+                    printf( "  trace change %u at tick %u with duty 0x%04X not recorded\n", (unsigned) change, (unsigned) tick, (unsigned) duty );
+                    is_ok = false;
+                }
+
+                duty_prev = duty;
+                change++;
+            }
+        }
+
+        if  (   ( true == is_ok )
+            &&  (   ( pos != g_trace_len )
+                ||  ( change != edge_num_of )))
+        {
+            printf( "  %u trace changes, expected %u\n", (unsigned) change, (unsigned) edge_num_of );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Blinking of GPIO LED with count out of blink enumeration and
+    *       subscribed blink done event
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_event_run(void)
+    {
+        (void) led_set_event_mask( eLED_STATUS, eLED_EVENT_BLINK_DONE );
+        (void) led_blink( eLED_STATUS, 0.1f, 0.5f, LED_BLINK_CNT( TEST_BLINK_CNT_NUM_OF ));
+        test_hndl( ( TEST_BLINK_CNT_NUM_OF + 1U ) * TEST_BLINK_PERIOD_TICK );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check blink count and blink done event
+    *
+    * @brief    LED shall blink given number of times and blink done event
+    *           shall be reported once, after last blink.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_event_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            cb_num_of   = 0U;
+        const mock_cb_t *   p_cb        = mock_cb_get( &cb_num_of );
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+        bool                is_ok       = test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_BLINK_CNT_NUM_OF );
+
+        if  (   ( true == is_ok )
+            &&  (   ( 1U != cb_num_of )
+                ||  ( eLED_STATUS != p_cb[0].num )
+                ||  ( eLED_EVENT_BLINK_DONE != p_cb[0].arg )
+                ||  ( p_cb[0].tick < p_edge[ edge_num_of - 1U ].tick )))
+        {
+            printf( "  %u events, expected single blink done event\n", (unsigned) cb_num_of );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_SEQ_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Nested loop sequence of timer PWM LED
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_seq_run(void)
+    {
+        (void) led_sequence( eLED_ERR_COM, g_seq );
+        test_hndl( 200U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check nested loop sequence
+    *
+    * @brief    Each full duty pulse shall last "TEST_SEQ_PULSE_TICK". Inner
+    *           loop shall give its pulses on each pass of outer loop,
+    *           followed by ramp, and sequence shall end OFF.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_seq_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        const uint32_t      pulse_num_of    = (( TEST_SEQ_INNER_REPEAT + 1U ) * ( TEST_SEQ_OUTER_REPEAT + 1U ));
+        const uint32_t      ramp_num_of     = ( TEST_SEQ_OUTER_REPEAT + 1U );
+        uint32_t            edge_num_of     = 0U;
+        const mock_rec_t *  p_edge          = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+        uint32_t            pulse_cnt       = 0U;
+        uint32_t            ramp_cnt        = 0U;
+        bool                is_ok           = ( edge_num_of > 0U );
+
+        for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+        {
+            // Pulse
+            if ( 1.0f == p_edge[i].value )
+            {
+                if  (   (( i + 1U ) >= edge_num_of )
+                    ||  ( 0.0f != p_edge[ i + 1U ].value )
+                    ||  ( TEST_SEQ_PULSE_TICK != ( p_edge[ i + 1U ].tick - p_edge[i].tick )))
+                {
+                    printf( "  pulse at tick %u not %u ticks long\n", (unsigned) p_edge[i].tick, (unsigned) TEST_SEQ_PULSE_TICK );
+                    is_ok = false;
+                }
+
+                pulse_cnt++;
+            }
+
+            // Top of ramp to half duty, target itself is reached at start of next step
+            else if (   ( p_edge[i].value > 0.0f )
+                    &&  (( i + 1U ) < edge_num_of )
+                    &&  ( 0.0f == p_edge[ i + 1U ].value ))
+            {
+                ramp_cnt++;
+            }
+            else
+            {
+                // Ramp or pulse end...
+            }
+        }
+
+        if  (   ( pulse_num_of != pulse_cnt )
+            ||  ( ramp_num_of != ramp_cnt ))
+        {
+            printf( "  %u pulses and %u ramps, expected %u and %u\n", (unsigned) pulse_cnt, (unsigned) ramp_cnt, (unsigned) pulse_num_of, (unsigned) ramp_num_of );
+            is_ok = false;
+        }
+
+        if  (   ( edge_num_of > 0U )
+            &&  ( 0.0f != p_edge[ edge_num_of - 1U ].value ))
+        {
+            printf( "  ends at %.4f\n", p_edge[ edge_num_of - 1U ].value );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_CMD_QUEUE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Posted LED commands
+    *
+    * @note     Blink of timer PWM LED is superseded by later set command
+    *           before handler call.
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_cmd_run(void)
+    {
+        (void) led_cmd_blink( eLED_STATUS, 0.1f, 0.5f, eLED_BLINK_3X );
+        (void) led_cmd_blink( eLED_ERR_COM, 0.1f, 0.5f, eLED_BLINK_3X );
+        (void) led_cmd_set( eLED_ERR_COM, eLED_ON );
+        test_hndl( 200U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check posted LED commands
+    *
+    * @brief    GPIO LED shall blink as with direct API call and timer PWM
+    *           LED shall only turn ON.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_cmd_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = NULL;
+        bool                is_ok       = test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_BLINK_NUM_OF );
+
+        p_edge = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+
+        if  (   ( 1U != edge_num_of )
+            ||  ( 1.0f != p_edge[0].value ))
+        {
+            printf( "  superseded blink command executed\n" );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_LIMIT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Global brightness and current budget shared with ON/OFF LED
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_limit_run(void)
+    {
+        (void) led_set_brightness( TEST_LIMIT_BRIGHTNESS );
+        (void) led_set( eLED_ERR_COM, eLED_ON );
+        test_hndl( 10U );
+
+        (void) led_set_brightness( 1.0f );
+        test_hndl( 10U );
+
+        (void) led_set( eLED_STATUS, eLED_ON );
+        test_hndl( 10U );
+
+        (void) led_set( eLED_STATUS, eLED_OFF );
+        test_hndl( 10U );
+
+        (void) led_set( eLED_ERR_COM, eLED_OFF );
+        test_hndl( 10U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check global brightness and current budget
+    *
+    * @brief    Timer PWM LED shall follow global brightness and shall be
+    *           scaled to current left by GPIO LED while it is ON.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_limit_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        const led_cfg_t *   p_cfg       = led_cfg_get_table();
+        float               budget      = 1.0f;
+        float               step[ TEST_LIMIT_STEP_NUM_OF ];
+        uint32_t            step_num_of = 0U;
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = NULL;
+        bool                is_ok       = true;
+
+        // Current left by GPIO LED
+        if ( LED_CFG_LIMIT_BUDGET_MA > 0 )
+        {
+            budget = ((float) LED_CFG_LIMIT_BUDGET_MA - (float) p_cfg[eLED_STATUS].current_ma ) / (float) p_cfg[eLED_ERR_COM].current_ma;
+            budget = ( budget < 0.0f ) ? ( 0.0f ) : ( budget );
+            budget = ( budget > 1.0f ) ? ( 1.0f ) : ( budget );
+        }
+
+        // Expected timer duty steps, equal neighbours are single step
+        const float expect[ TEST_LIMIT_STEP_NUM_OF ] = { TEST_LIMIT_BRIGHTNESS, 1.0f, budget, 1.0f, 0.0f };
+
+        for ( uint32_t i = 0; i < TEST_LIMIT_STEP_NUM_OF; i++ )
+        {
+            if  (   ( 0U == step_num_of )
+                ||  ( fabsf( expect[i] - step[ step_num_of - 1U ] ) > TEST_DUTY_TOL ))
+            {
+                step[ step_num_of ] = expect[i];
+                step_num_of++;
+            }
+        }
+
+        p_edge = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+
+        if ( step_num_of != edge_num_of )
+        {
+            printf( "  %u timer duty steps, expected %u\n", (unsigned) edge_num_of, (unsigned) step_num_of );
+            is_ok = false;
+        }
+
+        for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+        {
+            if ( fabsf( step[i] - p_edge[i].value ) > TEST_DUTY_TOL )
+            {
+                printf( "  timer duty %.4f at tick %u, expected %.4f\n", p_edge[i].value, (unsigned) p_edge[i].tick, step[i] );
+                is_ok = false;
+            }
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_RAMP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Ramp of timer PWM LED retargeted half way
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_ramp_run(void)
+    {
+        (void) led_ramp_to( eLED_ERR_COM, TEST_RAMP_DUTY, ( TEST_RAMP_TICK * LED_CFG_HNDL_PERIOD_S ));
+        test_hndl( TEST_RAMP_TICK / 2U );
+
+        (void) led_ramp_to( eLED_ERR_COM, TEST_RAMP_RE_DUTY, ( TEST_RAMP_RE_TICK * LED_CFG_HNDL_PERIOD_S ));
+        test_hndl( TEST_RAMP_TICK );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check retargeted ramp
+    *
+    * @brief    Duty shall rise towards first target and after retarget fall
+    *           directly from current duty to new target in retarget time,
+    *           without passing through zero.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_ramp_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+        const uint32_t      re_tick     = ( TEST_RAMP_TICK / 2U );
+        uint32_t            end_tick    = 0U;
+        bool                is_ok       = ( edge_num_of > 0U );
+
+        for ( uint32_t i = 0; ( i < edge_num_of ) && ( true == is_ok ); i++ )
+        {
+            const bool is_rise = ( p_edge[i].tick < re_tick );
+            const float prev   = ( i > 0U ) ? ( p_edge[ i - 1U ].value ) : ( 0.0f );
+
+            if  (   ( 0.0f == p_edge[i].value )
+                ||  (( true == is_rise ) && ( p_edge[i].value < prev ))
+                ||  (( false == is_rise ) && ( p_edge[i].value > prev )))
+            {
+                printf( "  duty %.4f at tick %u\n", p_edge[i].value, (unsigned) p_edge[i].tick );
+                is_ok = false;
+            }
+
+            end_tick = p_edge[i].tick;
+        }
+
+        // Retargeted ramp ends in its own ramp time
+        if  (   ( true == is_ok )
+            &&  (   (( end_tick + 1U ) < ( re_tick + TEST_RAMP_RE_TICK ))
+                ||  ( end_tick > ( re_tick + TEST_RAMP_RE_TICK ))))
+        {
+            printf( "  ramp ends at tick %u\n", (unsigned) end_tick );
+            is_ok = false;
+        }
+
+        #if ( 0 == LED_CFG_GAMMA_EN )
+
+            if  (   ( true == is_ok )
+                &&  ( fabsf( TEST_RAMP_RE_DUTY - p_edge[ edge_num_of - 1U ].value ) > TEST_DUTY_TOL ))
+            {
+                printf( "  ramp ends at %.4f\n", p_edge[ edge_num_of - 1U ].value );
+                is_ok = false;
+            }
+
+        #endif
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_BULK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bulk set of GPIO and timer PWM LED by bitmap and by array
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_bulk_run(void)
+    {
+        const uint32_t      mask[ LED_MASK_NUM_OF ]     = {[0] = (( 1UL << eLED_STATUS ) | ( 1UL << eLED_ERR_COM )) };
+        const led_state_t   state[ eLED_NUM_OF ]        = { eLED_OFF };
+
+        (void) led_set_mask( mask, mask );
+        (void) led_snapshot( &g_bulk_snap[0] );
+        test_hndl( 10U );
+        (void) led_snapshot( &g_bulk_snap[1] );
+
+        (void) led_set_many( (led_num_t) 0, state, (uint16_t) eLED_NUM_OF );
+        test_hndl( 10U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check bulk set
+    *
+    * @brief    Staged states shall be applied to both LEDs in same handler
+    *           call and shall be visible by snapshot after it.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_bulk_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        const uint32_t      both        = (( 1UL << eLED_STATUS ) | ( 1UL << eLED_ERR_COM ));
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+        uint32_t            tick[2]     = { 0U };
+        bool                is_ok       = ( 2U == edge_num_of );
+
+        if ( true == is_ok )
+        {
+            tick[0] = p_edge[0].tick;
+            tick[1] = p_edge[1].tick;
+
+            p_edge = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+
+            if  (   ( 2U != edge_num_of )
+                ||  ( tick[0] != p_edge[0].tick )
+                ||  ( tick[1] != p_edge[1].tick ))
+            {
+                printf( "  LEDs not applied in same handler call\n" );
+                is_ok = false;
+            }
+        }
+        else
+        {
+            printf( "  %u GPIO edges, expected 2\n", (unsigned) edge_num_of );
+        }
+
+        if  (   ( 0U != ( g_bulk_snap[0].on[0] & both ))
+            ||  ( both != ( g_bulk_snap[1].on[0] & both )))
+        {
+            printf( "  snapshot ON bitmap 0x%08X before and 0x%08X after handler call\n", (unsigned) g_bulk_snap[0].on[0], (unsigned) g_bulk_snap[1].on[0] );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bulk set superseded by later set of single LED
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_bulk_override_run(void)
+    {
+        const uint32_t mask[ LED_MASK_NUM_OF ] = {[0] = (( 1UL << eLED_STATUS ) | ( 1UL << eLED_ERR_COM )) };
+
+        (void) led_set_mask( mask, mask );
+        (void) led_set( eLED_ERR_COM, eLED_OFF );
+        test_hndl( 10U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check bulk set superseded by later set
+    *
+    * @brief    GPIO LED shall turn ON by staged state, while timer PWM LED
+    *           shall keep state of later set.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_bulk_override_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of );
+        bool                is_ok       = true;
+
+        if  (   ( 1U != edge_num_of )
+            ||  ( 0.0f == p_edge[0].value ))
+        {
+            printf( "  staged state of GPIO LED not applied\n" );
+            is_ok = false;
+        }
+
+        (void) test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+
+        if ( 0U != edge_num_of )
+        {
+            printf( "  staged state overrides later set\n" );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+#if ( 1 == LED_CFG_GROUP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Finite blinking of group with GPIO and timer PWM LED
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_group_blink_run(void)
+    {
+        (void) led_group_add( eLED_GROUP_ALL, eLED_STATUS );
+        (void) led_group_add( eLED_GROUP_ALL, eLED_ERR_COM );
+
+        (void) led_group_blink( eLED_GROUP_ALL, 0.1f, 0.5f, eLED_BLINK_3X );
+        test_hndl( 200U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check group blinking
+    *
+    * @brief    Both members shall blink with group timing in same ticks and
+    *           shall be released from group after last blink.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_group_blink_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t    edge_num_of = 0U;
+        uint32_t    gpio_tick   = 0U;
+        bool        is_idle     = false;
+        bool        is_ok       = test_blink_edges( p_rec, num_of, eMOCK_DRV_GPIO, TEST_BLINK_NUM_OF );
+
+        gpio_tick   = test_edges( p_rec, num_of, eMOCK_DRV_GPIO, &edge_num_of )[0].tick;
+        is_ok       = is_ok && test_blink_edges( p_rec, num_of, eMOCK_DRV_TIMER, TEST_BLINK_NUM_OF );
+
+        if  (   ( true == is_ok )
+            &&  ( gpio_tick != test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of )[0].tick ))
+        {
+            printf( "  members out of phase\n" );
+            is_ok = false;
+        }
+
+        (void) led_is_idle( eLED_ERR_COM, &is_idle );
+
+        if ( false == is_idle )
+        {
+            printf( "  member not released\n" );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Fade in and out of group
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_group_fade_run(void)
+    {
+        (void) led_group_add( eLED_GROUP_ALL, eLED_STATUS );
+        (void) led_group_add( eLED_GROUP_ALL, eLED_ERR_COM );
+
+        (void) led_group_set_smooth( eLED_GROUP_ALL, eLED_ON );
+        test_hndl( TEST_GROUP_FADE_TICK + 10U );
+
+        (void) led_group_set_smooth( eLED_GROUP_ALL, eLED_OFF );
+        test_hndl( TEST_GROUP_FADE_TICK + 10U );
+    }
+
+#endif
+
+#if (( 1 == LED_CFG_GROUP_EN ) && ( 1 == LED_CFG_EVENT_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Finite blinking of group with event subscribed by single member
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void test_group_event_run(void)
+    {
+        (void) led_group_add( eLED_GROUP_ALL, eLED_STATUS );
+        (void) led_group_add( eLED_GROUP_ALL, eLED_ERR_COM );
+        (void) led_set_event_mask( eLED_ERR_COM, eLED_EVENT_BLINK_DONE );
+
+        (void) led_group_blink( eLED_GROUP_ALL, 0.1f, 0.5f, eLED_BLINK_3X );
+        test_hndl( 200U );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check events of group members
+    *
+    * @brief    Subscribed member shall report blink done event once, when
+    *           group releases it after last blink.
+    *
+    * @param[in]    p_rec   - Recorded writes
+    * @param[in]    num_of  - Number of recorded writes
+    * @return       is_ok   - Waveform is as expected
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool test_group_event_check(const mock_rec_t * const p_rec, const uint32_t num_of)
+    {
+        uint32_t            cb_num_of   = 0U;
+        const mock_cb_t *   p_cb        = mock_cb_get( &cb_num_of );
+        uint32_t            edge_num_of = 0U;
+        const mock_rec_t *  p_edge      = test_edges( p_rec, num_of, eMOCK_DRV_TIMER, &edge_num_of );
+        bool                is_ok       = test_group_blink_check( p_rec, num_of );
+
+        if  (   ( true == is_ok )
+            &&  (   ( 1U != cb_num_of )
+                ||  ( eLED_ERR_COM != p_cb[0].num )
+                ||  ( eLED_EVENT_BLINK_DONE != p_cb[0].arg )
+                ||  ( p_cb[0].tick < p_edge[ edge_num_of - 1U ].tick )))
+        {
+            printf( "  %u events, expected single blink done event of member\n", (unsigned) cb_num_of );
+            is_ok = false;
+        }
+
+        return is_ok;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare recorded waveform against golden trace
+*
+* @brief    Ticks, drivers and channels shall match exactly, values within
+*           "TEST_DUTY_TOL".
+*
+* @param[in]    p_path  - Golden trace file
+* @param[in]    p_rec   - Recorded writes
+* @param[in]    num_of  - Number of recorded writes
+* @return       is_ok   - Waveform matches golden trace
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_golden_cmp(const char * const p_path, const mock_rec_t * const p_rec, const uint32_t num_of)
+{
+    bool        is_ok   = true;
+    FILE *      p_file  = fopen( p_path, "r" );
+    uint32_t    line    = 0U;
+    unsigned    tick    = 0U;
+    char        drv     = 0;
+    unsigned    ch      = 0U;
+    float       value   = 0.0f;
+
+    if ( NULL == p_file )
+    {
+        printf( "  missing golden trace %s\n", p_path );
+        is_ok = false;
+    }
+    else
+    {
+        while (( true == is_ok ) && ( 4 == fscanf( p_file, "%u %c %u %f", &tick, &drv, &ch, &value )))
+        {
+            if ( line >= num_of )
+            {
+                printf( "  golden line %u: waveform ends early\n", (unsigned) ( line + 1U ));
+                is_ok = false;
+            }
+            else if (   ( tick != p_rec[line].tick )
+                    ||  ( drv != (( eMOCK_DRV_GPIO == p_rec[line].drv ) ? 'G' : 'T' ))
+                    ||  ( ch != p_rec[line].ch )
+                    ||  ( fabsf( value - p_rec[line].value ) > TEST_DUTY_TOL ))
+            {
+                printf( "  golden line %u: expected %u %c %u %.4f, recorded %u %c %u %.4f\n", (unsigned) ( line + 1U ),
+                        tick, drv, ch, value,
+                        (unsigned) p_rec[line].tick, ( eMOCK_DRV_GPIO == p_rec[line].drv ) ? 'G' : 'T', (unsigned) p_rec[line].ch, p_rec[line].value );
+                is_ok = false;
+            }
+            else
+            {
+                line++;
+            }
+        }
+
+        if  (   ( true == is_ok )
+            &&  ( line != num_of ))
+        {
+            printf( "  waveform has %u writes, golden trace %u\n", (unsigned) num_of, (unsigned) line );
+            is_ok = false;
+        }
+
+        (void) fclose( p_file );
+    }
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Write recorded waveform as golden trace
+*
+* @param[in]    p_path  - Golden trace file
+* @return       is_ok   - Golden trace written
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_golden_write(const char * const p_path)
+{
+    bool    is_ok   = false;
+    FILE *  p_file  = fopen( p_path, "w" );
+
+    if ( NULL != p_file )
+    {
+        mock_rec_print( p_file );
+        is_ok = ( 0 == fclose( p_file ));
+    }
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run all test cases
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Golden trace directory or "-" and optional "-u"
+* @return       Zero when all tests pass
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    const bool  is_update   = (( argc > 2 ) && ( 0 == strcmp( argv[2], "-u" )));
+    uint32_t    fail_cnt    = 0U;
+    char        path[256];
+
+    if ( argc < 2 )
+    {
+        printf( "Usage: %s <golden_dir|" TEST_GOLDEN_NONE "> [-u]\n", argv[0] );
+        return 2;
+    }
+
+    for ( uint32_t i = 0; i < ( sizeof( g_test ) / sizeof( g_test[0] )); i++ )
+    {
+        const mock_rec_t *  p_rec   = NULL;
+        uint32_t            num_of  = 0U;
+        bool                is_ok   = false;
+
+        // Start from freshly initialized LEDs at tick zero, initial writes are not recorded
+        (void) led_deinit();
+        mock_reset();
+        is_ok = ( eLED_OK == led_init());
+        mock_rec_clear();
+
+        g_test[i].pf_run();
+        p_rec = mock_rec_get( &num_of );
+
+        (void) snprintf( path, sizeof( path ), "%s/%s.txt", argv[1], g_test[i].name );
+
+        is_ok = is_ok && g_test[i].pf_check( p_rec, num_of );
+
+        if ( 0 == strcmp( argv[1], TEST_GOLDEN_NONE ))
+        {
+            // Option build, behaviour checks only
+        }
+        else if ( true == is_update )
+        {
+            is_ok = is_ok && test_golden_write( path );
+        }
+        else
+        {
+            is_ok = is_ok && test_golden_cmp( path, p_rec, num_of );
+        }
+
+        printf( "%s %s\n", ( true == is_ok ) ? "PASS" : "FAIL", g_test[i].name );
+
+        if ( false == is_ok )
+        {
+            fail_cnt++;
+        }
+    }
+
+    return ( 0U == fail_cnt ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
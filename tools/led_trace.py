@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+# Copyright (c) 2023 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+##
+## @file       led_trace.py
+## @brief      Decoder of LED output trace
+## @author     Ziga Miklosic
+## @email      ziga.miklosic@gmail.com
+## @date       14.10.2026
+## @version    V1.2.0
+##
+## @note       Decodes binary trace stream drained by "led_trace_read()" and
+##             rebuilds LED output waveforms as CSV or VCD file.
+##
+##             Trace entry:
+##                 - tick delta to previous entry (varint)
+##                 - LED number (varint), 0xFFFF marks lost entries
+##                 - duty in Q16 format or number of lost entries (uint16 LE)
+##
+##             Usage:
+##                 led_trace.py trace.bin --period 0.01 --csv out.csv
+##                 led_trace.py trace.bin --period 0.01 --vcd out.vcd
+##
+################################################################################
+
+import argparse
+import sys
+
+# LED number of lost entries marker
+LED_TRACE_NUM_LOST = 0xFFFF
+
+
+################################################################################
+## Read varint from stream
+##
+## @param[in]   data    - Trace stream
+## @param[in]   pos     - Position in stream
+## @return      value, pos, or None when stream ends inside varint
+################################################################################
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+
+    while pos < len(data):
+        byte = data[pos]
+        pos += 1
+        value |= ( byte & 0x7F ) << shift
+        shift += 7
+
+        if 0 == ( byte & 0x80 ):
+            return value, pos
+
+    return None
+
+
+################################################################################
+## Decode trace stream
+##
+## @param[in]   data    - Trace stream
+## @return      entries - List of (tick, led, duty) and number of lost entries
+################################################################################
+def decode(data):
+    entries = []
+    lost    = 0
+    tick    = 0
+    pos     = 0
+
+    while pos < len(data):
+        delta = read_varint(data, pos)
+        if delta is None:
+            break
+        tick += delta[0]
+
+        num = read_varint(data, delta[1])
+        if ( num is None ) or (( num[1] + 2 ) > len(data)):
+            break
+
+        value = data[num[1]] | ( data[num[1] + 1] << 8 )
+        pos = num[1] + 2
+
+        if LED_TRACE_NUM_LOST == num[0]:
+            print("Warning: %u trace entries lost before tick %u" % ( value, tick ), file=sys.stderr)
+            lost += value
+        else:
+            entries.append(( tick, num[0], value ))
+
+    return entries, lost
+
+
+################################################################################
+## Write entries as CSV
+################################################################################
+def write_csv(file, entries, period):
+    file.write("time_s,tick,led,duty\n")
+
+    for tick, led, duty in entries:
+        file.write("%.6f,%u,%u,%.5f\n" % ( tick * period, tick, led, duty / 65535.0 ))
+
+
+################################################################################
+## Write entries as VCD, one real variable per LED
+################################################################################
+def write_vcd(file, entries, period):
+    leds = sorted(set( led for _, led, _ in entries ))
+    ids  = { led: "l%u" % led for led in leds }
+
+    file.write("$timescale 1 us $end\n")
+    file.write("$scope module led $end\n")
+    for led in leds:
+        file.write("$var real 1 %s led_%u $end\n" % ( ids[led], led ))
+    file.write("$upscope $end\n")
+    file.write("$enddefinitions $end\n")
+
+    last = None
+    for tick, led, duty in entries:
+        if tick != last:
+            file.write("#%u\n" % round( tick * period * 1e6 ))
+            last = tick
+        file.write("r%.5f %s\n" % ( duty / 65535.0, ids[led] ))
+
+
+################################################################################
+## Main
+################################################################################
+def main():
+    parser = argparse.ArgumentParser(description="Decode LED output trace")
+    parser.add_argument("trace", help="binary trace file")
+    parser.add_argument("--period", type=float, default=0.01, help="LED handler period in seconds (LED_CFG_HNDL_PERIOD_S)")
+    parser.add_argument("--csv", help="output CSV file (default: stdout)")
+    parser.add_argument("--vcd", help="output VCD file")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as file:
+        entries, lost = decode(file.read())
+
+    if args.vcd:
+        with open(args.vcd, "w") as file:
+            write_vcd(file, entries, args.period)
+
+    if args.csv:
+        with open(args.csv, "w") as file:
+            write_csv(file, entries, args.period)
+    elif not args.vcd:
+        write_csv(sys.stdout, entries, args.period)
+
+    if lost > 0:
+        print("Warning: %u trace entries lost in total" % lost, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()